@@ -0,0 +1,101 @@
+#include "PricingEngine/PricingExecutor.hpp"
+#include "PricingEngine/TradePricer.hpp"
+#include "Utils/TradeFile.hpp"
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <string>
+
+/**
+ * Pricing non interactif d'un fichier de trades (CSV ou JSONL).
+ * Usage : batch_pricer <trades> [-o resultats] [-j threads] [--format csv|jsonl]
+ * Le fichier est lu au fil de l'eau : au plus "fenetre" trades sont en mémoire,
+ * et les résultats sont écrits dans l'ordre du fichier dès qu'ils sont prêts.
+ */
+int main(int argc, char* argv[]) {
+
+    std::string input_name, output_name;
+    unsigned threads = 0;
+    std::string output_format;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "-o" && i + 1 < argc) output_name = argv[++i];
+        else if (arg == "-j" && i + 1 < argc) threads = static_cast<unsigned>(std::stoul(argv[++i]));
+        else if (arg == "--format" && i + 1 < argc) output_format = argv[++i];
+        else input_name = arg;
+    }
+    if (input_name.empty()) {
+        std::cerr << "Usage : batch_pricer <trades.csv|trades.jsonl|-> [-o resultats] [-j threads] [--format csv|jsonl]" << std::endl;
+        return 1;
+    }
+
+    // 1. Flux d'entrée et de sortie ("-" = entrée standard)
+    std::ifstream input_file;
+    if (input_name != "-") {
+        input_file.open(input_name);
+        if (!input_file.is_open()) {
+            std::cerr << "Erreur : impossible d'ouvrir " << input_name << std::endl;
+            return 1;
+        }
+    }
+    std::istream& input = (input_name == "-") ? std::cin : input_file;
+
+    std::ofstream output_file;
+    if (!output_name.empty()) {
+        output_file.open(output_name);
+        if (!output_file.is_open()) {
+            std::cerr << "Erreur : impossible de creer " << output_name << std::endl;
+            return 1;
+        }
+    }
+    std::ostream& output = output_name.empty() ? std::cout : output_file;
+
+    TradeReader reader(input);
+    PricingExecutor executor(threads);
+    const std::size_t window = 4 * static_cast<std::size_t>(executor.getThreadCount());
+
+    std::unique_ptr<TradeResultWriter> writer;
+    std::deque<std::future<TradeResult>> in_flight;
+    std::size_t priced = 0, failed = 0;
+
+    auto writeFront = [&]() {
+        TradeResult result = in_flight.front().get();
+        in_flight.pop_front();
+        writer->write(result);
+        ++priced;
+        if (!result.error.empty()) ++failed;
+    };
+
+    auto start = std::chrono::steady_clock::now();
+
+    // 2. Lecture incrémentale, pricing parallèle, écriture dans l'ordre d'arrivée.
+    // Une ligne illisible donne une ligne de résultat en erreur, la lecture continue.
+    TradeSpec trade;
+    while (reader.next(trade)) {
+        if (!writer) {
+            TradeReader::Format format = reader.getFormat();
+            if (output_format == "csv") format = TradeReader::Format::CSV;
+            if (output_format == "jsonl") format = TradeReader::Format::JSONL;
+            writer = std::make_unique<TradeResultWriter>(output, format);
+        }
+
+        auto task = std::make_shared<std::packaged_task<TradeResult()>>(
+            [trade]() { return TradePricer::price(trade); });
+        in_flight.push_back(task->get_future());
+        executor.submit([task]() { (*task)(); });
+
+        if (in_flight.size() >= window) writeFront();
+    }
+
+    while (!in_flight.empty()) writeFront();
+    output.flush();
+
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cerr << priced << " trades pricés (" << failed << " en erreur) en " << elapsed << " s sur "
+              << executor.getThreadCount() << " threads" << std::endl;
+    return failed == 0 ? 0 : 2;
+}
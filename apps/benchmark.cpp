@@ -0,0 +1,289 @@
+#include "Models/GBM.hpp"
+#include "Models/RNG.hpp"
+#include "Options/EuropeanCall.hpp"
+#include "Options/AsianOption.hpp"
+#include "PricingEngine/MonteCarloPricer.hpp"
+#include "PricingEngine/GreeksPricer.hpp"
+#include "PricingEngine/EDPSolver.hpp"
+#include "Utils/BlackScholesFormulas.hpp"
+#include "Utils/Instrumentation.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Suite de benchmarks de tous les moteurs, sortie JSON.
+ * Usage : benchmark [--quick] [--output fichier.json]
+ * Chaque mesure donne le temps (meilleur de 3 répétitions), le débit et, quand
+ * une référence analytique existe, l'erreur et un indicateur "accurate".
+ * Le code de retour vaut 1 si un contrôle de précision échoue (gating des releases).
+ */
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    struct BenchmarkRecord {
+        std::string name;
+        std::map<std::string, double> params;
+        double seconds = 0.0;       // durée d'une exécution (meilleure des répétitions)
+        double throughput = 0.0;    // unités par seconde
+        std::string unit;
+        std::map<std::string, double> metrics;   // prix, référence, erreur...
+        bool has_check = false;
+        bool accurate = true;
+    };
+
+    // Meilleur temps sur plusieurs répétitions (la première exécution sert d'échauffement)
+    double timeBest(const std::function<void()>& run, int repetitions = 3) {
+        run();
+        double best = 1e300;
+        for (int i = 0; i < repetitions; ++i) {
+            Clock::time_point start = Clock::now();
+            run();
+            best = std::min(best, std::chrono::duration<double>(Clock::now() - start).count());
+        }
+        return best;
+    }
+
+    void writeNumber(std::ostream& os, double value) {
+        if (std::isfinite(value)) os << value;
+        else os << "null";
+    }
+
+    void writeMap(std::ostream& os, const std::map<std::string, double>& values) {
+        os << "{";
+        bool first = true;
+        for (const auto& entry : values) {
+            os << (first ? "" : ", ") << "\"" << entry.first << "\": ";
+            writeNumber(os, entry.second);
+            first = false;
+        }
+        os << "}";
+    }
+
+    void writeJSON(std::ostream& os, const std::vector<BenchmarkRecord>& records, bool quick) {
+        os << std::setprecision(10);
+        os << "{\n  \"suite\": \"option_pricer\",\n  \"format_version\": 1,\n";
+#ifdef NDEBUG
+        os << "  \"build\": \"release\",\n";
+#else
+        os << "  \"build\": \"debug\",\n";
+#endif
+        os << "  \"quick\": " << (quick ? "true" : "false") << ",\n";
+        if (Instrumentation::isEnabled()) {
+            os << "  \"instrumentation\": " << Instrumentation::toJSON(Instrumentation::globalSnapshot()) << ",\n";
+        }
+        os << "  \"results\": [\n";
+        for (std::size_t i = 0; i < records.size(); ++i) {
+            const BenchmarkRecord& r = records[i];
+            os << "    {\"name\": \"" << r.name << "\", \"params\": ";
+            writeMap(os, r.params);
+            os << ", \"seconds\": ";
+            writeNumber(os, r.seconds);
+            os << ", \"throughput\": ";
+            writeNumber(os, r.throughput);
+            os << ", \"unit\": \"" << r.unit << "\", \"metrics\": ";
+            writeMap(os, r.metrics);
+            if (r.has_check) os << ", \"accurate\": " << (r.accurate ? "true" : "false");
+            os << "}" << (i + 1 < records.size() ? "," : "") << "\n";
+        }
+        os << "  ]\n}\n";
+    }
+}
+
+int main(int argc, char* argv[]) {
+
+    bool quick = false;
+    std::string output_name;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--quick") quick = true;
+        else if (arg == "--output" && i + 1 < argc) output_name = argv[++i];
+    }
+
+    // Paramètres de référence : Call ATM, S0 = 100, r = 5 %, sigma = 20 %, T = 1 an
+    const double S0 = 100.0, K = 100.0, r = 0.05, sigma = 0.2, T = 1.0;
+    const double bs_price = BlackScholesFormulas::callPrice(S0, K, T, r, sigma);
+    const double bs_delta = BlackScholesFormulas::deltaCall(S0, K, T, r, sigma);
+    const int scale = quick ? 10 : 1;
+
+    std::vector<BenchmarkRecord> records;
+    RNG& rng = RNG::getInstance();
+
+    // 1. Tirages gaussiens
+    {
+        const std::size_t n = 4000000 / scale;
+        std::vector<double> buffer(n);
+        BenchmarkRecord rec;
+        rec.name = "rng_normal";
+        rec.params["draws"] = static_cast<double>(n);
+        rec.seconds = timeBest([&]() { rng.fillStandardNormal(buffer.data(), n); });
+        rec.throughput = n / rec.seconds;
+        rec.unit = "draws/s";
+        records.push_back(rec);
+    }
+
+    // 2. Génération de trajectoires GBM (par blocs de 256, comme le moteur MC)
+    for (int steps : {1, 12, 52, 252}) {
+        GBM gbm(S0, steps, r, sigma);
+        const int paths = std::max(256, 2000000 / (steps * scale));
+        PathBatch batch;
+        BenchmarkRecord rec;
+        rec.name = "gbm_path_batch";
+        rec.params["steps"] = steps;
+        rec.params["paths"] = paths;
+        rec.seconds = timeBest([&]() {
+            for (int done = 0; done < paths; done += 256) {
+                batch.resize(static_cast<std::size_t>(std::min(256, paths - done)), steps, 1);
+                gbm.generatePathBatch(T, batch);
+            }
+        });
+        rec.throughput = paths / rec.seconds;
+        rec.unit = "paths/s";
+        rec.metrics["steps_per_second"] = static_cast<double>(paths) * steps / rec.seconds;
+        records.push_back(rec);
+    }
+
+    // 3. Monte Carlo standard et antithétique (erreur mesurée en écarts-types)
+    GBM gbm1(S0, 1, r, sigma);
+    EuropeanCall call(T, r, K);
+    const int mc_paths = 1000000 / scale;
+    double mc_standard_error = 0.0;
+    for (bool antithetic : {false, true}) {
+        MonteCarloPricer pricer(call, gbm1);
+        PricingResult res(0.0, 0.0, {});
+        BenchmarkRecord rec;
+        rec.name = antithetic ? "mc_antithetic" : "mc_standard";
+        rec.params["paths"] = mc_paths;
+        rec.params["steps"] = 1;
+        rng.seed(2024);
+        rec.seconds = timeBest([&]() {
+            res = antithetic ? pricer.calculatePriceMinVar(mc_paths) : pricer.calculatePrice(mc_paths);
+        });
+        rec.throughput = mc_paths / rec.seconds;
+        rec.unit = "paths/s";
+        rec.metrics["price"] = res.price;
+        rec.metrics["reference"] = bs_price;
+        rec.metrics["error"] = res.price - bs_price;
+        rec.metrics["standard_error"] = res.standard_error;
+        rec.metrics["z_score"] = (res.price - bs_price) / res.standard_error;
+        rec.has_check = true;
+        rec.accurate = std::abs(res.price - bs_price) <= 4.0 * res.standard_error;
+        if (!antithetic) mc_standard_error = res.standard_error;
+        records.push_back(rec);
+    }
+
+    // 4. Monte Carlo sur une option asiatique (charge dépendante du chemin)
+    {
+        GBM gbm252(S0, 252, r, sigma);
+        AsianOption asian(T, r, K);
+        const int paths = 100000 / scale;
+        PricingResult res(0.0, 0.0, {});
+        BenchmarkRecord rec;
+        rec.name = "mc_asian";
+        rec.params["paths"] = paths;
+        rec.params["steps"] = 252;
+        rec.seconds = timeBest([&]() { res = MonteCarloPricer(asian, gbm252).calculatePrice(paths); });
+        rec.throughput = paths / rec.seconds;
+        rec.unit = "paths/s";
+        rec.metrics["price"] = res.price;
+        rec.metrics["standard_error"] = res.standard_error;
+        records.push_back(rec);
+    }
+
+    // 5. Grecs par différences finies (3 pricings MC indépendants)
+    {
+        const int paths = 200000 / scale;
+        const double eps = 0.01 * S0;
+        GreeksPricer greeks(call, gbm1);
+        GreeksResult res{0.0, 0.0};
+        BenchmarkRecord rec;
+        rec.name = "greeks_delta_gamma";
+        rec.params["paths_per_bump"] = paths;
+        rec.params["epsilon"] = eps;
+        rec.seconds = timeBest([&]() { res = greeks.calculateDeltaGamma(paths, eps); }, 1);
+        rec.throughput = 3.0 * paths / rec.seconds;
+        rec.unit = "paths/s";
+        // Erreur standard du delta : deux pricings indépendants, SE(V) extrapolée du run MC standard
+        double delta_se = std::sqrt(2.0) * mc_standard_error * std::sqrt(static_cast<double>(mc_paths) / paths) / (2.0 * eps);
+        rec.metrics["delta"] = res.delta;
+        rec.metrics["delta_reference"] = bs_delta;
+        rec.metrics["delta_error"] = res.delta - bs_delta;
+        rec.metrics["delta_standard_error"] = delta_se;
+        rec.metrics["gamma"] = res.gamma;
+        rec.metrics["gamma_reference"] = BlackScholesFormulas::gammaCallPut(S0, K, T, r, sigma);
+        rec.has_check = true;
+        rec.accurate = std::abs(res.delta - bs_delta) <= 5.0 * delta_se;
+        records.push_back(rec);
+    }
+
+    // 6. EDP explicite (S0 sur un noeud de la grille, N choisi pour la stabilité)
+    for (int M : {100, 200, 400}) {
+        if (quick && M > 200) break;
+        // S_max ajusté pour que S0 tombe sur un noeud (le solveur lit le noeud le plus proche)
+        const double S_max = S0 * M / std::round(M / 3.0);
+        const int N = std::max(1000, static_cast<int>(2.0 * T * sigma * sigma * M * M) + 1);
+        EDPSolver edp(call, gbm1);
+        double price = 0.0;
+        BenchmarkRecord rec;
+        rec.name = "edp_explicit";
+        rec.params["space_steps"] = M;
+        rec.params["time_steps"] = N;
+        rec.seconds = timeBest([&]() { price = edp.solve(S_max, M, N); }, 1);
+        rec.throughput = static_cast<double>(M) * N / rec.seconds;
+        rec.unit = "nodes/s";
+        rec.metrics["price"] = price;
+        rec.metrics["reference"] = bs_price;
+        rec.metrics["error"] = price - bs_price;
+        rec.has_check = true;
+        rec.accurate = std::abs(price - bs_price) <= 0.05;
+        records.push_back(rec);
+    }
+
+    // 7. Formules de Black-Scholes en lot (grille de strikes), contrôle par la parité call-put
+    {
+        const int n = 2000000 / scale;
+        std::vector<double> strikes(n), calls(n), puts(n);
+        for (int i = 0; i < n; ++i) strikes[i] = 50.0 + 100.0 * i / n;
+        BenchmarkRecord rec;
+        rec.name = "black_scholes_batch";
+        rec.params["calls"] = n;
+        rec.seconds = timeBest([&]() {
+            for (int i = 0; i < n; ++i) calls[i] = BlackScholesFormulas::callPrice(S0, strikes[i], T, r, sigma);
+        });
+        for (int i = 0; i < n; ++i) puts[i] = BlackScholesFormulas::putPrice(S0, strikes[i], T, r, sigma);
+        double parity_error = 0.0;
+        for (int i = 0; i < n; ++i) {
+            parity_error = std::max(parity_error,
+                                    std::abs(calls[i] - puts[i] - (S0 - strikes[i] * std::exp(-r * T))));
+        }
+        rec.throughput = n / rec.seconds;
+        rec.unit = "prices/s";
+        rec.metrics["max_parity_error"] = parity_error;
+        rec.has_check = true;
+        rec.accurate = parity_error <= 1e-9;
+        records.push_back(rec);
+    }
+
+    // 8. Sortie JSON (fichier ou sortie standard)
+    if (output_name.empty()) {
+        writeJSON(std::cout, records, quick);
+    } else {
+        std::ofstream file(output_name);
+        writeJSON(file, records, quick);
+        std::cerr << "Resultats ecrits dans " << output_name << std::endl;
+    }
+
+    bool all_accurate = std::all_of(records.begin(), records.end(),
+                                    [](const BenchmarkRecord& rec) { return rec.accurate; });
+    return all_accurate ? 0 : 1;
+}
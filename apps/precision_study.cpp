@@ -0,0 +1,112 @@
+#include "Models/GBM.hpp"
+#include "Models/RNG.hpp"
+#include "Options/EuropeanCall.hpp"
+#include "Options/AsianOption.hpp"
+#include "PricingEngine/MonteCarloPricer.hpp"
+#include "Utils/BlackScholesFormulas.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Étude de précision de la simulation float32 face au moteur double.
+ * Usage : precision_study [chemins] [graines]
+ * Pour chaque cas (calls à 252 pas, asiatique mensuel et quotidien), les deux
+ * précisions sont pricées sur les mêmes graines. On affiche :
+ *  - le prix moyen et l'erreur standard de chaque précision ;
+ *  - l'écart float32 - float64 en nombre d'erreurs standard (les deux moteurs
+ *    n'utilisent pas les mêmes tirages : un écart de quelques unités est du bruit) ;
+ *  - l'erreur par rapport à Black-Scholes quand elle existe ;
+ *  - le temps de calcul et l'accélération.
+ */
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Case {
+        std::string name;
+        std::unique_ptr<Option> option;
+        std::unique_ptr<GBM> model;
+        double reference;   // NaN sans formule fermée
+    };
+
+    struct Run {
+        double price = 0.0;
+        double variance = 0.0;   // somme des SE^2 sur les graines
+        double seconds = 0.0;
+    };
+
+    Run runAll(const Case& c, SimulationPrecision precision, int paths, int seeds) {
+        Run run;
+        MonteCarloPricer pricer(*c.option, *c.model);
+        pricer.setKeepDistribution(false);
+        pricer.setPrecision(precision);
+        for (int s = 0; s < seeds; ++s) {
+            RNG::getInstance().seed(1000 + static_cast<std::uint64_t>(s));
+            Clock::time_point start = Clock::now();
+            PricingResult result = pricer.calculatePrice(paths);
+            run.seconds += std::chrono::duration<double>(Clock::now() - start).count();
+            run.price += result.price;
+            run.variance += result.standard_error * result.standard_error;
+        }
+        // Moyenne sur les graines : son erreur standard est sqrt(somme SE^2) / graines
+        run.price /= seeds;
+        run.variance /= static_cast<double>(seeds) * seeds;
+        return run;
+    }
+}
+
+int main(int argc, char* argv[]) {
+
+    const int paths = (argc > 1) ? std::atoi(argv[1]) : 200000;
+    const int seeds = (argc > 2) ? std::atoi(argv[2]) : 5;
+    const double S0 = 100.0, r = 0.05, sigma = 0.2, T = 1.0;
+
+    // 1. Cas étudiés
+    std::vector<Case> cases;
+    cases.push_back({"call ATM (252 pas)", std::make_unique<EuropeanCall>(T, r, 100.0),
+                     std::make_unique<GBM>(S0, 252, r, sigma), BlackScholesFormulas::callPrice(S0, 100.0, T, r, sigma)});
+    cases.push_back({"call OTM K=150", std::make_unique<EuropeanCall>(T, r, 150.0),
+                     std::make_unique<GBM>(S0, 252, r, sigma), BlackScholesFormulas::callPrice(S0, 150.0, T, r, sigma)});
+    cases.push_back({"asiatique (12 pas)", std::make_unique<AsianOption>(T, r, 100.0),
+                     std::make_unique<GBM>(S0, 12, r, sigma), std::nan("")});
+    cases.push_back({"asiatique (252 pas)", std::make_unique<AsianOption>(T, r, 100.0),
+                     std::make_unique<GBM>(S0, 252, r, sigma), std::nan("")});
+
+    std::cout << "Simulation float32 vs float64 : " << paths << " chemins x " << seeds << " graines\n\n";
+    std::cout << std::left << std::setw(22) << "cas" << std::right
+              << std::setw(12) << "prix f64" << std::setw(12) << "prix f32"
+              << std::setw(10) << "SE" << std::setw(12) << "ecart/SE"
+              << std::setw(12) << "err f64" << std::setw(12) << "err f32"
+              << std::setw(10) << "t f64" << std::setw(10) << "t f32" << std::setw(9) << "gain" << "\n";
+
+    // 2. Les deux précisions sur les mêmes graines
+    for (const Case& c : cases) {
+        Run run64 = runAll(c, SimulationPrecision::Float64, paths, seeds);
+        Run run32 = runAll(c, SimulationPrecision::Float32, paths, seeds);
+
+        double se = std::sqrt(run64.variance);
+        double gap = (run32.price - run64.price) / std::sqrt(run64.variance + run32.variance);
+
+        std::cout << std::fixed << std::left << std::setw(22) << c.name << std::right << std::setprecision(5)
+                  << std::setw(12) << run64.price << std::setw(12) << run32.price
+                  << std::setw(10) << se << std::setprecision(2) << std::setw(12) << gap << std::setprecision(5);
+        if (std::isnan(c.reference)) {
+            std::cout << std::setw(12) << "-" << std::setw(12) << "-";
+        } else {
+            std::cout << std::setw(12) << run64.price - c.reference << std::setw(12) << run32.price - c.reference;
+        }
+        std::cout << std::setprecision(3) << std::setw(9) << run64.seconds << "s" << std::setw(9) << run32.seconds << "s"
+                  << std::setprecision(2) << std::setw(8) << run64.seconds / run32.seconds << "x\n";
+    }
+
+    std::cout << "\nL'arrondi float (~6e-8 relatif par pas) reste très inférieur à l'erreur Monte Carlo ;\n"
+              << "payoffs et moments sont accumulés en double (sommation compensée par lot).\n";
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include "PricingEngine/PricingServer.hpp"
+#include "Utils/LatencyHistogram.hpp"
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <unistd.h>
+#endif
+
+/**
+ * Générateur de charge pour le serveur de pricing.
+ * Usage : pricing_load [--address adresse] [--clients C] [--requests N] [--paths P]
+ * Sans --address, un serveur est démarré dans le processus sur une socket Unix
+ * temporaire : le test tourne entièrement en local.
+ * Chaque client envoie N requêtes Monte Carlo (calls sur le même GBM, strikes
+ * différents) et attend chaque réponse : les requêtes simultanées des clients
+ * sont regroupées par le serveur sur les mêmes trajectoires.
+ */
+int main(int argc, char* argv[]) {
+
+    std::string address;
+    int clients = 8, requests = 200, paths = 20000;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        if (arg == "--address") address = argv[i + 1];
+        else if (arg == "--clients") clients = std::stoi(argv[i + 1]);
+        else if (arg == "--requests") requests = std::stoi(argv[i + 1]);
+        else if (arg == "--paths") paths = std::stoi(argv[i + 1]);
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+    std::signal(SIGPIPE, SIG_IGN);
+#endif
+
+    try {
+        // 1. Serveur embarqué si aucune adresse n'est donnée
+        std::unique_ptr<PricingServer> embedded;
+        if (address.empty()) {
+#if defined(__unix__) || defined(__APPLE__)
+            address = "unix:/tmp/option_pricer_load_" + std::to_string(::getpid()) + ".sock";
+#endif
+            ServerSettings settings;
+            settings.address = address;
+            embedded = std::make_unique<PricingServer>(settings);
+            embedded->start();
+        }
+
+        // 2. Clients en boucle fermée, latence mesurée côté client
+        LatencyHistogram client_latency;
+        std::atomic<int> failures(0);
+        std::vector<std::thread> threads;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int c = 0; c < clients; ++c) {
+            threads.emplace_back([&, c]() {
+                try {
+                    PricingClient client(address);
+                    TradeSpec trade;
+                    trade.option_type = "call";
+                    trade.engine = "mc";
+                    trade.max_paths = paths;
+                    for (int i = 0; i < requests; ++i) {
+                        trade.id = std::to_string(c) + "-" + std::to_string(i);
+                        trade.strikes = {80.0 + 5.0 * ((c + i) % 9)};
+                        auto sent = std::chrono::steady_clock::now();
+                        TradeResult result = client.price(trade);
+                        client_latency.record(static_cast<std::uint64_t>(
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now() - sent).count()));
+                        if (!result.error.empty()) ++failures;
+                    }
+                } catch (const std::exception& e) {
+                    std::cerr << e.what() << std::endl;
+                    ++failures;
+                }
+            });
+        }
+        for (std::thread& t : threads) t.join();
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        // 3. Rapport client et statistiques du serveur
+        std::cout << "Requetes : " << client_latency.getCount() << " en " << elapsed << " s ("
+                  << client_latency.getCount() / elapsed << " req/s), echecs : " << failures.load() << std::endl;
+        std::cout << "Latence client : " << client_latency.summary() << std::endl;
+        std::cout << "--- Serveur ---\n" << PricingClient(address).getServerStatistics();
+
+        if (embedded) embedded->stop();
+        return failures.load() == 0 ? 0 : 2;
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
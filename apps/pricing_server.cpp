@@ -0,0 +1,54 @@
+#include "PricingEngine/PricingServer.hpp"
+#include <csignal>
+#include <iostream>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <unistd.h>
+#endif
+
+namespace {
+    volatile std::sig_atomic_t stop_requested = 0;
+    void onSignal(int) { stop_requested = 1; }
+}
+
+/**
+ * Démon de pricing local.
+ * Usage : pricing_server [--address unix:/tmp/option_pricer.sock | tcp:5555] [-j threads] [--window us]
+ * Arrêt par Ctrl-C : les statistiques de latence sont affichées en sortie.
+ */
+int main(int argc, char* argv[]) {
+
+    ServerSettings settings;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        if (arg == "--address") settings.address = argv[i + 1];
+        else if (arg == "-j") settings.num_threads = static_cast<unsigned>(std::stoul(argv[i + 1]));
+        else if (arg == "--window") settings.coalesce_window_us = std::stoi(argv[i + 1]);
+    }
+
+    std::signal(SIGINT, onSignal);
+    std::signal(SIGTERM, onSignal);
+#if defined(__unix__) || defined(__APPLE__)
+    std::signal(SIGPIPE, SIG_IGN);
+#endif
+
+    try {
+        PricingServer server(settings);
+        server.start();
+        std::cout << "Serveur de pricing en ecoute sur " << settings.address << std::endl;
+
+        while (!stop_requested) {
+#if defined(__unix__) || defined(__APPLE__)
+            ::pause();
+#endif
+        }
+
+        server.stop();
+        std::cout << "\n" << server.getStatistics();
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,47 @@
+#include "Core/ScenarioFile.hpp"
+#include "PricingEngine/ScenarioPricer.hpp"
+#include "Options/AsianOption.hpp"
+#include "Options/EuropeanCall.hpp"
+#include "Models/GBM.hpp"
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+
+int main(int argc, char* argv[]) {
+    // Fichier de scénarios (par défaut dans le dossier courant)
+    std::string filename = (argc > 1) ? argv[1] : "scenarios.bin";
+
+    GBM gbm(100.0, 100, 0.05, 0.2);
+    std::uint64_t n_paths = 200000;
+
+    std::cout << std::fixed << std::setprecision(6);
+    std::cout << "Precision\tTemps ecriture (s)\tAsian Call\tCall\t\tTemps pricing (s)" << std::endl;
+
+    for (ScenarioPrecision precision : {ScenarioPrecision::Float64, ScenarioPrecision::Float32}) {
+        ScenarioHeader header;
+        header.model_name = "GBM";
+        header.parameters = {{"S0", gbm.getS0()}, {"mu", gbm.getMu()}, {"sigma", gbm.getSigma()}};
+        header.seed = 2024;
+        header.precision = precision;
+
+        // 1. Simulation une seule fois, écriture en flux bloc par bloc
+        auto start = std::chrono::steady_clock::now();
+        ScenarioWriter::generate(filename, gbm, 1.0, n_paths, header);
+        double write_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        // 2. Plusieurs options pricées sur les mêmes trajectoires (fichier mappé en lecture seule)
+        ScenarioFile scenarios(filename);
+        AsianOption asian(1.0, 0.05, 100.0);
+        EuropeanCall call(1.0, 0.05, 100.0);
+
+        start = std::chrono::steady_clock::now();
+        PricingResult asian_res = ScenarioPricer(asian, scenarios).calculatePrice();
+        PricingResult call_res = ScenarioPricer(call, scenarios).calculatePrice();
+        double price_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << (precision == ScenarioPrecision::Float64 ? "float64" : "float32") << "\t\t"
+                  << write_time << "\t\t" << asian_res.price << "\t" << call_res.price << "\t" << price_time << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,34 @@
+#include "PricingEngine/ShardedPricer.hpp"
+#include "Options/AsianOption.hpp"
+#include "Models/GBM.hpp"
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+
+int main() {
+    // Asian Call sur GBM, même graine pour chaque configuration
+    GBM gbm(100.0, 100, 0.05, 0.2);
+    AsianOption asian(1.0, 0.05, 100.0);
+    ShardedPricer pricer(asian, gbm);
+
+    long long n_sims = 1000000;
+
+    std::cout << std::fixed << std::setprecision(6);
+    std::cout << "Workers\tPrix\t\tErreur std\tTemps (s)" << std::endl;
+
+    for (int workers : {1, 2, 4, 8}) {
+        ShardSettings settings;
+        settings.num_workers = workers;
+        settings.batch_size = 50000;
+        settings.seed = 2024;
+
+        auto start = std::chrono::steady_clock::now();
+        PricingResult res = pricer.calculatePrice(n_sims, settings);
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        // Le prix ne dépend que de (seed, n_sims, batch_size) : il doit être identique sur chaque ligne
+        std::cout << workers << "\t" << res.price << "\t" << res.standard_error << "\t" << elapsed << std::endl;
+    }
+
+    return 0;
+}
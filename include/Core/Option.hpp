@@ -2,6 +2,7 @@
 #define OPTION_HPP
 
 #include <cmath>
+#include <string>
 #include <vector>  
 #include <iostream> 
 
@@ -70,6 +71,18 @@ class Option{
             return std::exp(-r * T);
         }
 
+        /**
+         * @brief Name of the contract type, used in canonical keys (see PricingCache).
+         * An empty name (the default) means the option does not describe its parameters,
+         * so its results are never cached.
+         */
+        virtual std::string getName() const { return ""; }
+
+        /**
+         * @brief Every number that defines the contract, in a fixed order (T and r first).
+         */
+        virtual std::vector<double> getParameters() const { return {T, r}; }
+
 };
 
 #endif 
\ No newline at end of file
@@ -10,6 +10,14 @@
  * @brief Represents a single simulated trajectory of asset prices over time.
  * * This class stores a sequence of discrete price points S_t from t=0 to T.
  * It provides utility methods required by path-dependent options (Asian, Lookback).
+ * * A path may also hold several underlyings (multi-asset models). The series are
+ * then stored asset-major: all points of asset 0, then all points of asset 1, etc.
+ * The single-asset accessors (getFinalPrice, getAveragePrice, at...) refer to asset 0.
+ * * A path either owns its prices (std::vector) or is a non-owning view over a
+ * buffer supplied by the caller (a PathArena block, a mapped scenario file...).
+ * Views let the engines evaluate payoffs without copying or allocating; the
+ * caller keeps the buffer alive while the view is used. Copying a view copies
+ * the pointer, not the prices.
  */
 class Path{
 
@@ -26,6 +34,48 @@ class Path{
          */
         Path(const std::vector<double>& prices_in);
 
+        /**
+         * @brief Multi-asset constructor.
+         * @param prices_in The asset-major price series (num_assets_in blocks of equal length).
+         * @param num_assets_in The number of underlyings.
+         * @throw std::invalid_argument If the size is not a multiple of num_assets_in.
+         */
+        Path(const std::vector<double>& prices_in, std::size_t num_assets_in);
+
+        /**
+         * @brief Takes over the storage of prices_in (no copy).
+         */
+        Path(std::vector<double>&& prices_in);
+
+        /**
+         * @brief Multi-asset constructor taking over the storage of prices_in (no copy).
+         * @throw std::invalid_argument If the size is not a multiple of num_assets_in.
+         */
+        Path(std::vector<double>&& prices_in, std::size_t num_assets_in);
+
+        /**
+         * @brief Creates a non-owning view over size prices (asset-major).
+         * @param prices_in The first price; must outlive the view.
+         * @param size Total number of values (num_assets_in * (steps + 1)).
+         * @param num_assets_in The number of underlyings.
+         */
+        static Path view(const double* prices_in, std::size_t size, std::size_t num_assets_in = 1);
+
+        /**
+         * @brief Turns this path into a view over another buffer (the owned storage is kept for reuse).
+         * Passing nullptr makes the path use its owned storage again.
+         */
+        void setView(const double* prices_in, std::size_t size, std::size_t num_assets_in = 1) {
+            view_data = prices_in;
+            view_size = size;
+            num_assets = num_assets_in;
+        }
+
+        /**
+         * @brief True if the path reads a caller-supplied buffer instead of its own storage.
+         */
+        bool isView() const { return view_data != nullptr; }
+
         // --- Accessor Methods ---
 
         /**
@@ -61,11 +111,36 @@ class Path{
         double getMinPrice() const;
 
         /**
-         * @brief Gets the total number of price points stored (steps + 1).
-         * @return The size of the internal price vector.
+         * @brief Gets the number of price points per asset (steps + 1).
+         * @return The length of each price series.
          */
         size_t getLength() const;
 
+        /**
+         * @brief Gets the number of underlyings stored in the path (1 for single-asset models).
+         */
+        size_t getNumAssets() const { return num_assets; }
+
+        /**
+         * @brief Sets the number of underlyings, for models that fill data() in place.
+         * The size of data() must be a multiple of num_assets_in.
+         */
+        void setNumAssets(size_t num_assets_in) { num_assets = num_assets_in; }
+
+        /**
+         * @brief Retrieves the final price S_T of one underlying.
+         * @param asset The asset index (0 to getNumAssets() - 1).
+         * @return The final price of that asset.
+         */
+        double getFinalPrice(size_t asset) const;
+
+        /**
+         * @brief Accesses the price of one underlying at a specific time step index.
+         * @param asset The asset index.
+         * @param index The step index (0 for S0, Length-1 for S_T).
+         */
+        double assetAt(size_t asset, size_t index) const;
+
         /**
          * @brief Accesses the price at a specific time step index.
          * @param index The step index (0 for S0, Length-1 for S_T).
@@ -75,17 +150,40 @@ class Path{
 
         /**
          * @brief Provides a non-const reference to the internal data vector.
+         * If the path is a view, the viewed prices are first copied into it and the
+         * path becomes owning again.
          * @warning Use with caution. Primarily for advanced internal manipulation.
          * @return A mutable reference to the underlying std::vector<double>.
          */
-        std::vector<double>& data(){return prices;}
+        std::vector<double>& data();
+
+        /**
+         * @brief Read-only access to the prices (owned or viewed), asset-major.
+         */
+        const double* values() const { return view_data ? view_data : prices.data(); }
+
+        /**
+         * @brief Total number of values (getNumAssets() * getLength()).
+         */
+        size_t size() const { return view_data ? view_size : prices.size(); }
 
     private:
         /**
          * @brief Internal storage for the asset price sequence.
-         * The size is typically steps + 1 (including S0).
+         * The size is typically (steps + 1) * num_assets (including S0), asset-major.
          */
         std::vector<double> prices;
+
+        /**
+         * @brief Number of underlyings stored in prices.
+         */
+        size_t num_assets = 1;
+
+        /**
+         * @brief Viewed buffer (nullptr for an owning path) and its number of values.
+         */
+        const double* view_data = nullptr;
+        size_t view_size = 0;
         
 };
 
@@ -0,0 +1,102 @@
+#ifndef PATHARENA_HPP
+#define PATHARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Per-thread monotonic arena for path storage.
+ * * allocate() bumps a pointer inside the current chunk and only asks the heap
+ * for a new chunk when the current one is full. reset() releases every block
+ * at once; if the last cycle needed several chunks they are replaced by a
+ * single chunk of the total size, so after the first batch the engines reuse
+ * the same memory and the simulation loop makes no heap call at all.
+ * * Blocks are aligned on 64 bytes (one cache line). The arena is not thread
+ * safe: each thread uses its own instance through forThread(). Engines scope
+ * their blocks with PathArena::Scope rather than calling reset().
+ */
+class PathArena {
+
+    public:
+
+        /**
+         * @brief Creates an arena whose first chunk holds initial_capacity doubles.
+         */
+        explicit PathArena(std::size_t initial_capacity = 1 << 15);
+
+        PathArena(const PathArena&) = delete;
+        PathArena& operator=(const PathArena&) = delete;
+
+        /**
+         * @brief Returns n doubles of uninitialized memory, valid until the next reset().
+         */
+        double* allocate(std::size_t n);
+
+        /**
+         * @brief Releases every block (the memory is kept for the next cycle).
+         */
+        void reset();
+
+        /**
+         * @brief Total number of doubles held by the chunks.
+         */
+        std::size_t getCapacity() const;
+
+        /**
+         * @brief Number of doubles handed out since the last reset().
+         */
+        std::size_t getUsed() const { return used_before + offset; }
+
+        /**
+         * @brief Arena of the calling thread (created on first use, like the RNG).
+         */
+        static PathArena& forThread();
+
+        /**
+         * @brief Releases on destruction everything allocated since its construction.
+         * * Engines open one Scope per batch, so nested engines sharing the thread
+         * arena never release the blocks of their caller.
+         */
+        class Scope {
+
+            public:
+
+                explicit Scope(PathArena& arena_in)
+                    : arena(arena_in), current(arena_in.current), offset(arena_in.offset),
+                      used_before(arena_in.used_before) {}
+
+                ~Scope() {
+                    arena.current = current;
+                    arena.offset = offset;
+                    arena.used_before = used_before;
+                }
+
+                Scope(const Scope&) = delete;
+                Scope& operator=(const Scope&) = delete;
+
+            private:
+
+                PathArena& arena;
+                std::size_t current;
+                std::size_t offset;
+                std::size_t used_before;
+        };
+
+    private:
+
+        struct Chunk {
+            std::unique_ptr<double[]> memory;
+            double* begin;          // first 64-byte aligned double
+            std::size_t capacity;   // usable doubles from begin
+        };
+
+        std::vector<Chunk> chunks;
+        std::size_t current = 0;       // chunk being filled
+        std::size_t offset = 0;        // doubles used in the current chunk
+        std::size_t used_before = 0;   // doubles used in the previous chunks
+
+        void addChunk(std::size_t capacity);
+};
+
+#endif
@@ -0,0 +1,126 @@
+#ifndef PATHBATCH_HPP
+#define PATHBATCH_HPP
+
+#include <vector>
+#include <cstddef>
+
+#include "Path.hpp"
+
+/**
+ * @brief A block of simulated paths stored in Structure-of-Arrays layout.
+ * * Prices are stored time-major: row t holds S_t for every path of the batch,
+ * contiguously. A model can therefore update all paths of one time step in a
+ * single loop over contiguous memory, which the compiler vectorizes.
+ * * Multi-asset batches store one block of rows per asset (asset-major):
+ * row(asset, t) holds the price of that asset at time t for every path.
+ * * The batch also owns a scratch workspace (random draws, state variables such
+ * as the Heston variance) so that, once sized, repeated generations do not allocate.
+ * * The scalar type is a parameter: PathBatch stores doubles, PathBatch32 floats
+ * (reduced-precision simulation, see SimulationPrecision). Both hand their paths
+ * to the payoffs as doubles (extractPath, copyPathMajor).
+ */
+template <typename Real>
+class BasicPathBatch {
+
+    public:
+
+        /**
+         * @brief Default constructor (empty batch).
+         */
+        BasicPathBatch() = default;
+
+        /**
+         * @brief Creates a batch for num_paths paths of steps time steps.
+         */
+        BasicPathBatch(std::size_t num_paths, int steps, std::size_t num_assets = 1);
+
+        /**
+         * @brief Resizes the batch. Memory is only reallocated when growing.
+         * @param num_paths Number of paths.
+         * @param steps Number of time steps (each path has steps + 1 points).
+         * @param num_assets Number of underlyings per path.
+         */
+        void resize(std::size_t num_paths, int steps, std::size_t num_assets = 1);
+
+        /**
+         * @brief Number of paths in the batch.
+         */
+        std::size_t getNumPaths() const { return num_paths; }
+
+        /**
+         * @brief Number of time steps (points per path minus one).
+         */
+        int getSteps() const { return steps; }
+
+        /**
+         * @brief Number of underlyings per path.
+         */
+        std::size_t getNumAssets() const { return num_assets; }
+
+        /**
+         * @brief Prices of every path at time index t (num_paths contiguous values).
+         */
+        Real* row(int t) { return prices.data() + static_cast<std::size_t>(t) * num_paths; }
+        const Real* row(int t) const { return prices.data() + static_cast<std::size_t>(t) * num_paths; }
+
+        /**
+         * @brief Prices of every path for one asset at time index t.
+         */
+        Real* row(std::size_t asset, int t) {
+            return prices.data() + (asset * static_cast<std::size_t>(steps + 1) + static_cast<std::size_t>(t)) * num_paths;
+        }
+        const Real* row(std::size_t asset, int t) const {
+            return prices.data() + (asset * static_cast<std::size_t>(steps + 1) + static_cast<std::size_t>(t)) * num_paths;
+        }
+
+        /**
+         * @brief Price of path p at time index t (asset 0).
+         */
+        Real at(std::size_t p, int t) const { return row(t)[p]; }
+
+        /**
+         * @brief Copies path p (every asset) into out, reusing its storage (no allocation once sized).
+         */
+        void extractPath(std::size_t p, Path& out) const;
+
+        /**
+         * @brief Writes every path contiguously to out (path-major, each path asset-major).
+         * * Path p occupies out[p * L, (p + 1) * L) with L = getNumAssets() * (getSteps() + 1),
+         * so it can be read through Path::view(). The transposition runs by tiles.
+         * @param out At least getNumPaths() * L doubles (e.g. a PathArena block).
+         */
+        void copyPathMajor(double* out) const;
+
+        /**
+         * @brief Returns columns * num_paths values of scratch memory.
+         * * The content is unspecified; the pointer stays valid until the next call
+         * to getWorkspace() or resize(). Reallocates only when growing.
+         * @param columns Number of per-path arrays needed.
+         */
+        Real* getWorkspace(std::size_t columns);
+
+    private:
+
+        std::size_t num_paths = 0;
+        int steps = 0;
+        std::size_t num_assets = 1;
+
+        std::vector<Real> prices;      // num_assets * (steps + 1) rows of num_paths values
+        std::vector<Real> workspace;   // model scratch space
+};
+
+using PathBatch = BasicPathBatch<double>;
+using PathBatch32 = BasicPathBatch<float>;
+
+/**
+ * @brief Scalar type of the simulated paths.
+ * * Float64 is the reference. Float32 draws the normals, builds the log-increments
+ * and stores the paths in float (half the memory traffic, cheaper draws); payoffs
+ * and statistics are still computed in double.
+ */
+enum class SimulationPrecision {
+    Float64,
+    Float32
+};
+
+#endif // PATHBATCH_HPP
@@ -0,0 +1,177 @@
+#ifndef SCENARIOFILE_HPP
+#define SCENARIOFILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "PathBatch.hpp"
+
+class AssetModel;
+
+/**
+ * @brief Storage precision of the simulated prices.
+ */
+enum class ScenarioPrecision : std::uint32_t {
+    Float32 = 4,
+    Float64 = 8
+};
+
+/**
+ * @brief Description of a scenario set (stored at the beginning of the file).
+ */
+struct ScenarioHeader {
+    std::string model_name;
+    std::vector<std::pair<std::string, double>> parameters;   // model parameters, for traceability
+    std::uint64_t seed = 0;
+    double maturity = 0.0;
+    int steps = 0;
+    std::size_t num_assets = 1;
+    std::size_t block_paths = 256;                             // paths per stored block
+    ScenarioPrecision precision = ScenarioPrecision::Float64;
+    std::uint64_t num_paths = 0;                               // filled in when the writer is closed
+    std::vector<double> time_grid;                             // steps + 1 times (uniform if left empty)
+};
+
+/**
+ * @brief Streams simulated paths into a binary scenario file.
+ * * Format (little-endian): a header (tag "OPSC", version, ScenarioHeader fields)
+ * padded to 64 bytes, then the blocks. A block holds block_paths paths in the
+ * PathBatch layout: num_assets * (steps + 1) rows, each row contiguous over the
+ * paths of the block (columnar). Only the last block may be shorter, so the
+ * offset of every block is known without an index and a reader can map the
+ * file and use the rows in place.
+ */
+class ScenarioWriter {
+
+    public:
+
+        /**
+         * @brief Creates the file and writes the header.
+         * @throw std::runtime_error If the file cannot be created.
+         * @throw std::invalid_argument If the header is inconsistent.
+         */
+        ScenarioWriter(const std::string& filename, const ScenarioHeader& header);
+
+        /**
+         * @brief Closes the file if close() was not called (errors are ignored).
+         */
+        ~ScenarioWriter();
+
+        ScenarioWriter(const ScenarioWriter&) = delete;
+        ScenarioWriter& operator=(const ScenarioWriter&) = delete;
+
+        /**
+         * @brief Appends one block of paths.
+         * @param batch A batch of exactly block_paths paths (fewer only for the last block),
+         *              with the steps and assets of the header.
+         * @throw std::invalid_argument If the batch does not match, or follows a short block.
+         */
+        void append(const PathBatch& batch);
+
+        /**
+         * @brief Writes the final path count into the header and closes the file.
+         * @throw std::runtime_error If writing failed.
+         */
+        void close();
+
+        std::uint64_t getPathsWritten() const { return header.num_paths; }
+
+        /**
+         * @brief Simulates num_paths paths of a model and stores them.
+         * * Block b is generated from RNG stream (seed, b), so the file content only
+         * depends on the seed and the block size.
+         * @param filename The output file.
+         * @param model The model to simulate.
+         * @param T The horizon.
+         * @param num_paths Number of paths.
+         * @param header_in Descriptive fields (model name, parameters, seed, precision,
+         *                  block_paths); steps, assets and maturity are taken from the model.
+         * @return The header actually written.
+         */
+        static ScenarioHeader generate(const std::string& filename, const AssetModel& model, double T,
+                                       std::uint64_t num_paths, const ScenarioHeader& header_in);
+
+    private:
+
+        std::ofstream file;
+        ScenarioHeader header;
+        std::uint64_t count_offset = 0;   // position of num_paths in the file
+        bool short_block_written = false;
+        std::vector<float> conversion;    // float32 staging row
+};
+
+/**
+ * @brief Read-only view of a scenario file.
+ * * On POSIX systems the file is memory-mapped: blocks are read in place by every
+ * process that opens the same file (the pages are shared through the OS cache).
+ * Elsewhere the data section is loaded into memory.
+ */
+class ScenarioFile {
+
+    public:
+
+        /**
+         * @brief Opens and validates the file.
+         * @throw std::runtime_error If the file cannot be opened or is not a valid scenario file.
+         */
+        explicit ScenarioFile(const std::string& filename);
+
+        ~ScenarioFile();
+
+        ScenarioFile(const ScenarioFile&) = delete;
+        ScenarioFile& operator=(const ScenarioFile&) = delete;
+
+        const ScenarioHeader& getHeader() const { return header; }
+
+        std::size_t getNumBlocks() const;
+
+        /**
+         * @brief Number of paths stored in block b.
+         */
+        std::size_t getBlockPaths(std::size_t b) const;
+
+        /**
+         * @brief First value of block b (rows of getBlockPaths(b) values, see ScenarioWriter).
+         * Only the accessor matching the stored precision may be used.
+         * @throw std::logic_error If the precision does not match.
+         */
+        const double* blockData64(std::size_t b) const;
+        const float* blockData32(std::size_t b) const;
+
+        /**
+         * @brief Copies path p of block b (every asset) into out, converting float32 to double.
+         * Strided gather over every row: use copyPathMajor() to read whole blocks.
+         */
+        void extractPath(std::size_t b, std::size_t p, Path& out) const;
+
+        /**
+         * @brief Copies block b into a PathBatch (for engines that need a batch).
+         */
+        void readBlock(std::size_t b, PathBatch& out) const;
+
+        /**
+         * @brief Transposes block b straight from the file into path-major order,
+         * converting float32 to double (same layout as PathBatch::copyPathMajor).
+         * @param out At least getBlockPaths(b) * num_assets * (steps + 1) doubles
+         *            (e.g. a PathArena block).
+         */
+        void copyPathMajor(std::size_t b, double* out) const;
+
+    private:
+
+        const unsigned char* blockStart(std::size_t b) const;
+
+        ScenarioHeader header;
+        std::uint64_t data_offset = 0;
+        std::size_t values_per_path = 0;
+
+        const unsigned char* mapping = nullptr;   // the whole file
+        std::size_t mapping_size = 0;
+        std::vector<unsigned char> fallback;      // used when mmap is not available
+};
+
+#endif
@@ -2,6 +2,9 @@
 #define ASSETMODEL_HPP
 
 #include "../Core/Path.hpp" // For the Path type
+#include "../Core/PathBatch.hpp"
+#include <string>
+#include <vector>
 
 /**
  * @brief Abstract base class for asset price evolution models.
@@ -32,9 +35,60 @@ class AssetModel {
          */
         virtual Path generatePath(double T) const = 0;
 
+        /**
+         * @brief Fills a whole batch of paths (SoA layout, see PathBatch).
+         * * The batch must already be sized (num_paths, steps). The default implementation
+         * calls generatePath() for each path; models override it with a step-by-step
+         * update across all paths that vectorizes and does not allocate.
+         * @param T The option's time to maturity.
+         * @param batch The destination batch; its number of steps must equal getSteps()
+         *              and its number of assets getNumAssets().
+         * @throw std::invalid_argument If the batch does not match the model dimensions.
+         */
+        virtual void generatePathBatch(double T, PathBatch& batch) const;
+
+        /**
+         * @brief Fills a batch of single-precision paths (SimulationPrecision::Float32).
+         * * The default implementation simulates in double and rounds the prices to float,
+         * so every model can run in reduced precision; models override it to draw and
+         * update in float, which is where the speedup comes from.
+         * @param T The option's time to maturity.
+         * @param batch The destination batch, sized as for generatePathBatch().
+         * @throw std::invalid_argument If the batch does not match the model dimensions.
+         */
+        virtual void generatePathBatch32(double T, PathBatch32& batch) const;
+
         double getS0() const { return S0; }
         int getSteps() const { return steps; }
 
+        /**
+         * @brief Number of underlyings simulated per path (1 unless overridden).
+         */
+        virtual std::size_t getNumAssets() const { return 1; }
+
+        /**
+         * @brief Name of the model, used in canonical keys (see PricingCache).
+         * An empty name (the default) means the model does not describe its
+         * parameters, so results obtained with it are never cached.
+         */
+        virtual std::string getName() const { return ""; }
+
+        /**
+         * @brief Every number that defines the model, in a fixed order (S0 and steps first).
+         */
+        virtual std::vector<double> getParameters() const { return {S0, static_cast<double>(steps)}; }
+
+        /**
+         * @brief Discount factor to maturity T consistent with the model's drift.
+         * * The default discounts at the option's flat rate, exp(-r * T). Models driven
+         * by a rate curve override it with exp(-int_0^T r(t) dt), so that the drift and
+         * the discounting use the same rate whatever r the option carries.
+         * @param T The option's time to maturity.
+         * @param r The option's flat risk-free rate.
+         * @return The discount factor applied to the mean payoff.
+         */
+        virtual double getDiscountFactor(double T, double r) const;
+
     protected:
 
         double S0;    // Initial price of the underlying asset
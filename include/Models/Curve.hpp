@@ -0,0 +1,65 @@
+#ifndef CURVE_HPP
+#define CURVE_HPP
+
+#include <vector>
+
+/**
+ * @brief Time-dependent market curve (short rate, volatility, ...).
+ * * Piecewise-linear interpolation between the pillars, flat extrapolation
+ * before the first and after the last pillar. Integrals are exact, so a model
+ * can turn the curve into per-step coefficients without discretization error.
+ */
+class Curve {
+
+    public:
+
+        /**
+         * @brief Flat curve.
+         * @param value The constant value.
+         */
+        explicit Curve(double value);
+
+        /**
+         * @brief Curve through the given pillars.
+         * @param times_in Strictly increasing pillar times (in years).
+         * @param values_in Value at each pillar.
+         * @throw std::invalid_argument If sizes mismatch, are empty or times are not increasing.
+         */
+        Curve(const std::vector<double>& times_in, const std::vector<double>& values_in);
+
+        /**
+         * @brief Interpolated value at time t.
+         */
+        double value(double t) const;
+
+        /**
+         * @brief Exact integral of the curve over [t0, t1].
+         */
+        double integral(double t0, double t1) const;
+
+        /**
+         * @brief Exact integral of the squared curve over [t0, t1] (integrated variance of a vol curve).
+         */
+        double integralOfSquare(double t0, double t1) const;
+
+        const std::vector<double>& getTimes() const { return times; }
+        const std::vector<double>& getValues() const { return values; }
+
+        /**
+         * @brief Appends the knot count, the times and the values to out (canonical description).
+         */
+        void appendParameters(std::vector<double>& out) const;
+
+    private:
+
+        /**
+         * @brief Integral of f(value(t)) with Simpson's rule on each linear piece (exact for f of degree <= 2).
+         */
+        template <typename F>
+        double integratePieces(double t0, double t1, F f) const;
+
+        std::vector<double> times;
+        std::vector<double> values;
+};
+
+#endif
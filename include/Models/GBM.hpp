@@ -25,11 +25,36 @@ class GBM : public AssetModel {
         
         /**
          * @brief Generates a single Path of prices using the GBM formula.
+         * * Built in log space rather than step by step: all the normals are drawn at
+         * once, turned into log-increments drift + vol * Z, summed by
+         * VectorMath::cumulativeSum and exponentiated by VectorMath::exp. No serial
+         * dependency remains between steps, so long paths (e.g. 10k-step
+         * intraday grids) vectorize.
          * @param T The time to maturity.
          * @return The simulated Path object.
          */
         Path generatePath(double T) const override;
 
+        /**
+         * @brief Generates a whole batch of GBM paths, one time step at a time across all paths.
+         * * For each step, the normals of every path are drawn into the batch workspace and the
+         * update S_{t+1} = S_t * exp(drift + vol * Z) runs over contiguous rows, the
+         * exponential of the whole row being computed by VectorMath::exp.
+         * @param T The time to maturity.
+         * @param batch The destination batch (num_paths x getSteps()).
+         */
+        void generatePathBatch(double T, PathBatch& batch) const override;
+
+        /**
+         * @brief Single-precision version of generatePathBatch().
+         * * Normals, log-increments drift + vol * Z and prices are floats; drift and vol
+         * are computed in double and rounded once. The float exponential and the
+         * cheaper float draws roughly halve the cost of a step.
+         * @param T The time to maturity.
+         * @param batch The destination batch (num_paths x getSteps()).
+         */
+        void generatePathBatch32(double T, PathBatch32& batch) const override;
+
         /**
          * @brief Generates a pair of antithetic paths (Path and Path') for variance reduction.
          * * The pair is based on the same random sequence Z and its opposite -Z.
@@ -37,6 +62,18 @@ class GBM : public AssetModel {
          * @return A std::pair<Path, Path> containing the standard path and the antithetic path.
          */
         std::pair<Path, Path> generateMinVarPaths(double T) const; 
+
+        /**
+         * @brief Generates a pair of antithetic paths into existing Paths.
+         * * A two-path batch drawn with antithetic sampling (see SamplingScheme), the
+         * mechanism the engines use for every model. The storage of the paths is reused
+         * (a view is turned back into an owning path), so a loop over pairs does not
+         * allocate once both paths have been sized.
+         * @param T The time to maturity.
+         * @param path_std Receives the path built on Z.
+         * @param path_anti Receives the path built on -Z.
+         */
+        void generateMinVarPaths(double T, Path& path_std, Path& path_anti) const;
         
         /**
          * @brief Getter for the drift parameter (mu).
@@ -47,6 +84,11 @@ class GBM : public AssetModel {
          * @brief Getter for the volatility parameter (sigma).
          */
         double getSigma() const { return sigma; }
+
+        std::string getName() const override { return "GBM"; }
+        std::vector<double> getParameters() const override {
+            return {S0, static_cast<double>(steps), mu, sigma};
+        }
         
     private:
 
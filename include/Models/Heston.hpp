@@ -0,0 +1,95 @@
+#ifndef HESTON_HPP
+#define HESTON_HPP
+
+#include "AssetModel.hpp"
+
+/**
+ * @brief Heston stochastic volatility model.
+ * * dS/S = mu*dt + sqrt(v)*dW1
+ * * dv   = kappa*(theta - v)*dt + xi*sqrt(v)*dW2,   d<W1, W2> = rho*dt
+ * * Two discretisations of the variance are available:
+ * - QuadraticExponential: Andersen's QE scheme (2008) with the central (gamma1 = gamma2 = 1/2)
+ *   log-spot discretisation. The bias stays small even with a few steps per year.
+ * - FullTruncation: Euler scheme where the negative part of v is truncated in the drift
+ *   and diffusion (Lord, Koekkoek & van Dijk, 2010).
+ * * Batch generation keeps the log-spot and the variance of all paths in separate
+ * contiguous arrays (SoA), so each time step is a loop over contiguous memory.
+ */
+class Heston : public AssetModel {
+
+    public:
+
+        /**
+         * @brief Discretisation scheme of the variance process.
+         */
+        enum class Scheme { QuadraticExponential, FullTruncation };
+
+        /**
+         * @brief Constructs the Heston model.
+         * @param S0_in Initial asset price.
+         * @param steps_in Number of time steps.
+         * @param mu_in Drift (risk-neutral rate r for pricing).
+         * @param v0_in Initial variance.
+         * @param kappa_in Speed of mean reversion of the variance.
+         * @param theta_in Long-term variance.
+         * @param xi_in Volatility of the variance ("vol of vol").
+         * @param rho_in Correlation between the spot and variance Brownian motions.
+         * @param scheme_in Variance discretisation scheme.
+         * @throw std::invalid_argument If v0, kappa, theta or xi is negative/zero or |rho| > 1.
+         */
+        Heston(double S0_in, int steps_in, double mu_in, double v0_in, double kappa_in,
+               double theta_in, double xi_in, double rho_in,
+               Scheme scheme_in = Scheme::QuadraticExponential);
+
+        /**
+         * @brief Generates a single Path of prices.
+         * @param T The time to maturity.
+         * @return The simulated Path object.
+         */
+        Path generatePath(double T) const override;
+
+        /**
+         * @brief Generates a batch of paths with the SoA spot/variance update.
+         * Uses 4 columns of the batch workspace (log-spot, variance and two draws).
+         * @param T The time to maturity.
+         * @param batch The destination batch (num_paths x getSteps()).
+         */
+        void generatePathBatch(double T, PathBatch& batch) const override;
+
+        double getMu() const { return mu; }
+        double getV0() const { return v0; }
+        double getKappa() const { return kappa; }
+        double getTheta() const { return theta; }
+        double getXi() const { return xi; }
+        double getRho() const { return rho; }
+        Scheme getScheme() const { return scheme; }
+
+        std::string getName() const override { return "Heston"; }
+        std::vector<double> getParameters() const override {
+            return {S0, static_cast<double>(steps), mu, v0, kappa, theta, xi, rho,
+                    scheme == Scheme::QuadraticExponential ? 0.0 : 1.0};
+        }
+
+    private:
+
+        double mu;
+        double v0;
+        double kappa;
+        double theta;
+        double xi;
+        double rho;
+        Scheme scheme;
+
+        /**
+         * @brief Advances n paths by one time step.
+         * @param dt Time step.
+         * @param log_s Log-spots (updated in place).
+         * @param v Variances (updated in place).
+         * @param draw1 Scratch array of n values.
+         * @param draw2 Scratch array of n values.
+         * @param n Number of paths.
+         */
+        void step(double dt, double* log_s, double* v, double* draw1, double* draw2, std::size_t n) const;
+};
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef LOCALVOLGBM_HPP
+#define LOCALVOLGBM_HPP
+
+#include "AssetModel.hpp"
+#include "Curve.hpp"
+#include "LocalVolSurface.hpp"
+#include <vector>
+
+/**
+ * @brief Local volatility model dS/S = r(t) dt + sigma(t, S) dW.
+ * * Simulated with a log-Euler scheme. Everything that only depends on the step
+ * is precomputed in contiguous tables: the integrated rate of each step and the
+ * volatility row of the surface interpolated at the step start time. Inside a
+ * step, each path only performs a 1D linear interpolation in spot on a
+ * uniform grid (no search, no time interpolation).
+ * * The tables are built in the constructor for the pricing horizon; a call with a
+ * different maturity rebuilds them locally.
+ */
+class LocalVolGBM : public AssetModel {
+
+    public:
+
+        /**
+         * @brief Constructs the model and precomputes the step tables.
+         * @param S0_in Initial asset price.
+         * @param steps_in Number of time steps.
+         * @param rate_in Short-rate (drift) curve.
+         * @param surface_in Local volatility surface.
+         * @param horizon_in Maturity the step tables are built for (usually option.getT()).
+         */
+        LocalVolGBM(double S0_in, int steps_in, const Curve& rate_in, const LocalVolSurface& surface_in,
+                    double horizon_in);
+
+        /**
+         * @brief Generates a single Path of prices.
+         * @param T The time to maturity.
+         * @return The simulated Path object.
+         */
+        Path generatePath(double T) const override;
+
+        /**
+         * @brief Generates a batch of paths, one time step at a time across all paths.
+         * @param T The time to maturity.
+         * @param batch The destination batch (num_paths x getSteps()).
+         */
+        void generatePathBatch(double T, PathBatch& batch) const override;
+
+        const Curve& getRateCurve() const { return rate; }
+
+        /**
+         * @brief exp(-int_0^T r(t) dt) from the rate curve; the option's flat r is ignored.
+         */
+        double getDiscountFactor(double T, double r) const override;
+        const LocalVolSurface& getSurface() const { return surface; }
+
+        std::string getName() const override { return "LocalVolGBM"; }
+
+        /**
+         * @brief S0, steps, the knots of the rate curve, then the surface grid.
+         */
+        std::vector<double> getParameters() const override;
+        double getHorizon() const { return tables.horizon; }
+
+    private:
+
+        /**
+         * @brief Per-step coefficients for one maturity.
+         */
+        struct StepTables {
+            double horizon = 0.0;
+            double dt = 0.0;
+            std::vector<double> rate_integral;   // int r over each step
+            std::vector<double> vol_slices;      // steps rows of surface.getNumSpots() vols
+        };
+
+        StepTables buildTables(double T) const;
+
+        Curve rate;
+        LocalVolSurface surface;
+        StepTables tables;   // precomputed for the construction horizon
+};
+
+#endif
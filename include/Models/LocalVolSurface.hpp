@@ -0,0 +1,90 @@
+#ifndef LOCALVOLSURFACE_HPP
+#define LOCALVOLSURFACE_HPP
+
+#include <functional>
+#include <vector>
+
+/**
+ * @brief Local volatility surface sigma(t, S) sampled on a uniform (time x spot) grid.
+ * * Because the grid is uniform, locating a point is one multiplication and a
+ * truncation (no search), and the lookup is a bilinear interpolation between
+ * the four surrounding nodes. Points outside the grid are clamped to its edges.
+ * * For simulation, timeSlice() interpolates a whole spot row at a given time once,
+ * so that the per-path work inside a time step is a 1D linear interpolation.
+ */
+class LocalVolSurface {
+
+    public:
+
+        /**
+         * @brief Builds the surface from grid values.
+         * @param t_min_in First time node.
+         * @param t_max_in Last time node.
+         * @param num_times Number of time nodes (>= 2).
+         * @param s_min_in First spot node.
+         * @param s_max_in Last spot node.
+         * @param num_spots Number of spot nodes (>= 2).
+         * @param vols_in num_times * num_spots volatilities, row-major (row = time).
+         * @throw std::invalid_argument If the grid is degenerate or sizes mismatch.
+         */
+        LocalVolSurface(double t_min_in, double t_max_in, std::size_t num_times,
+                        double s_min_in, double s_max_in, std::size_t num_spots,
+                        const std::vector<double>& vols_in);
+
+        /**
+         * @brief Samples a volatility function on the uniform grid.
+         * @param sigma The local volatility function sigma(t, S).
+         * @return The sampled surface.
+         */
+        static LocalVolSurface fromFunction(double t_min, double t_max, std::size_t num_times,
+                                            double s_min, double s_max, std::size_t num_spots,
+                                            const std::function<double(double, double)>& sigma);
+
+        /**
+         * @brief Bilinear interpolation of sigma(t, S).
+         */
+        double vol(double t, double S) const;
+
+        /**
+         * @brief Interpolates in time the whole spot row at time t.
+         * @param t The time.
+         * @param out Destination, getNumSpots() values.
+         */
+        void timeSlice(double t, double* out) const;
+
+        /**
+         * @brief Linear interpolation in spot of a row produced by timeSlice().
+         */
+        double interpolateSlice(const double* slice, double S) const {
+            double x = (S - s_min) * inv_ds;
+            x = x < 0.0 ? 0.0 : (x > max_spot_index ? max_spot_index : x);
+            std::size_t j = static_cast<std::size_t>(x);
+            if (j >= num_spots - 1) j = num_spots - 2;
+            double w = x - static_cast<double>(j);
+            return slice[j] + w * (slice[j + 1] - slice[j]);
+        }
+
+        std::size_t getNumTimes() const { return num_times; }
+        std::size_t getNumSpots() const { return num_spots; }
+
+        /**
+         * @brief Appends the grid geometry and the volatilities to out (canonical description).
+         */
+        void appendParameters(std::vector<double>& out) const;
+
+    private:
+
+        double t_min;
+        double inv_dt;           // 1 / time spacing
+        std::size_t num_times;
+        double max_time_index;   // num_times - 1
+
+        double s_min;
+        double inv_ds;           // 1 / spot spacing
+        std::size_t num_spots;
+        double max_spot_index;   // num_spots - 1
+
+        std::vector<double> vols;   // row-major, row = time node
+};
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef MERTON_HPP
+#define MERTON_HPP
+
+#include "AssetModel.hpp"
+
+/**
+ * @brief Merton jump-diffusion model.
+ * * dS/S = (mu - lambda*k) dt + sigma dW + (J - 1) dN, where N is a Poisson process
+ * of intensity lambda and log J ~ N(jump_mean, jump_vol^2), k = E[J] - 1.
+ * The drift is compensated, so the discounted price is a martingale when mu = r.
+ * * Log-increments are independent, so every step is sampled exactly:
+ * given the number of jumps n of the step, the jump part is N(n*jump_mean, n*jump_vol^2).
+ */
+class Merton : public AssetModel {
+
+    public:
+
+        /**
+         * @brief Constructs the Merton model.
+         * @param S0_in Initial asset price.
+         * @param steps_in Number of time steps.
+         * @param mu_in Drift (risk-free rate r for pricing).
+         * @param sigma_in Diffusion volatility.
+         * @param lambda_in Jump intensity (expected number of jumps per year).
+         * @param jump_mean_in Mean of the log jump size.
+         * @param jump_vol_in Standard deviation of the log jump size.
+         * @throw std::invalid_argument If sigma, lambda or jump_vol is negative.
+         */
+        Merton(double S0_in, int steps_in, double mu_in, double sigma_in,
+               double lambda_in, double jump_mean_in, double jump_vol_in);
+
+        /**
+         * @brief Generates a single Path of prices.
+         * @param T The time to maturity.
+         * @return The simulated Path object.
+         */
+        Path generatePath(double T) const override;
+
+        /**
+         * @brief Generates a batch of paths, one time step at a time across all paths.
+         * * Per step: normals and Poisson counts are drawn in bulk, the diffusion update
+         * runs branch-free over the whole row, then the jump factor is applied only to
+         * the paths whose count is non-zero (a small fraction when lambda*dt is small).
+         * * With a single step the compound terminal distribution is sampled directly:
+         * log S_T | n ~ N(log S0 + drift*T + n*jump_mean, sigma^2*T + n*jump_vol^2),
+         * i.e. one normal and one Poisson draw per path.
+         * Uses 2 columns of the batch workspace.
+         * @param T The time to maturity.
+         * @param batch The destination batch (num_paths x getSteps()).
+         */
+        void generatePathBatch(double T, PathBatch& batch) const override;
+
+        double getMu() const { return mu; }
+        double getSigma() const { return sigma; }
+        double getLambda() const { return lambda; }
+        double getJumpMean() const { return jump_mean; }
+        double getJumpVol() const { return jump_vol; }
+
+        std::string getName() const override { return "Merton"; }
+        std::vector<double> getParameters() const override {
+            return {S0, static_cast<double>(steps), mu, sigma, lambda, jump_mean, jump_vol};
+        }
+
+        /**
+         * @brief Expected relative jump size k = exp(jump_mean + jump_vol^2 / 2) - 1.
+         */
+        double getMeanJumpSize() const;
+
+    private:
+
+        double mu;          // Drift parameter
+        double sigma;       // Diffusion volatility
+        double lambda;      // Jump intensity
+        double jump_mean;   // Mean of log J
+        double jump_vol;    // Standard deviation of log J
+};
+
+#endif
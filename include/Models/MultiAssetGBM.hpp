@@ -0,0 +1,79 @@
+#ifndef MULTIASSETGBM_HPP
+#define MULTIASSETGBM_HPP
+
+#include "AssetModel.hpp"
+#include <vector>
+
+/**
+ * @brief Correlated multi-asset Geometric Brownian Motion.
+ * * Each asset i follows dS_i/S_i = mu*dt + sigma_i*dW_i with d<W_i, W_j> = rho_ij*dt.
+ * The correlation matrix is factorized once (Cholesky, rho = L * L^T) in the
+ * constructor. At each time step, the independent normals of every path are
+ * correlated by a blocked lower-triangular matrix-vector product W = L * Z
+ * whose inner loop runs over the paths of the batch (contiguous memory).
+ * * Paths are stored asset-major (see Path and PathBatch), so the series of one
+ * asset are contiguous and a 50-name basket stays cache-resident.
+ */
+class MultiAssetGBM : public AssetModel {
+
+    public:
+
+        /**
+         * @brief Constructs the multi-asset model.
+         * @param S0s_in Initial price of each asset.
+         * @param steps_in Number of time steps.
+         * @param mu_in Common drift (risk-free rate r for pricing).
+         * @param sigmas_in Volatility of each asset.
+         * @param correlation_in Correlation matrix (row-major, n x n, symmetric, unit diagonal).
+         * @throw std::invalid_argument If sizes mismatch or the matrix is not positive definite.
+         */
+        MultiAssetGBM(const std::vector<double>& S0s_in, int steps_in, double mu_in,
+                      const std::vector<double>& sigmas_in,
+                      const std::vector<std::vector<double>>& correlation_in);
+
+        /**
+         * @brief Generates one multi-asset Path (asset-major).
+         * @param T The time to maturity.
+         * @return A Path with getNumAssets() series of steps + 1 points.
+         */
+        Path generatePath(double T) const override;
+
+        /**
+         * @brief Generates a batch of correlated paths, one time step at a time.
+         * Uses 2 * getNumAssets() columns of the batch workspace. The independent draws
+         * are filled one asset row at a time, as SamplingScheme requires.
+         * @param T The time to maturity.
+         * @param batch The destination batch (num_paths x getSteps() x getNumAssets()).
+         */
+        void generatePathBatch(double T, PathBatch& batch) const override;
+
+        /**
+         * @brief Number of underlyings.
+         */
+        std::size_t getNumAssets() const override { return S0s.size(); }
+
+        double getMu() const { return mu; }
+        const std::vector<double>& getS0s() const { return S0s; }
+        const std::vector<double>& getSigmas() const { return sigmas; }
+
+        /**
+         * @brief Lower-triangular Cholesky factor of the correlation matrix (row-major, n x n).
+         */
+        const std::vector<double>& getCholeskyFactor() const { return cholesky; }
+
+        std::string getName() const override { return "MultiAssetGBM"; }
+
+        /**
+         * @brief S0 of the first asset and steps (the base order), the other S0s, mu, the sigmas and the Cholesky factor.
+         */
+        std::vector<double> getParameters() const override;
+
+    private:
+
+        std::vector<double> S0s;
+        double mu;
+        std::vector<double> sigmas;
+        std::vector<double> cholesky;   // L, row-major, zeros above the diagonal
+};
+
+#endif
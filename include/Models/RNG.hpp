@@ -2,19 +2,48 @@
 #define RNG_HPP
 
 #include <random>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief Variance-reduction applied by RNG::fillStandardNormal to each buffer it fills.
+ * * The scheme acts on each buffer as a whole, so it is only valid if every buffer is
+ * one row of paths: one value per path for a single factor (one asset, one Brownian
+ * driver) at one time step. The generatePathBatch implementations respect this
+ * (multi-factor models such as Heston or MultiAssetGBM fill one row per factor), so a
+ * scheme set on the generator applies to any of them without model-specific code.
+ * A buffer mixing factors or time steps would pair unrelated draws. MonteCarloPricer
+ * sets the scheme around generatePathBatch() only.
+ */
+struct SamplingScheme {
+
+    /**
+     * @brief Adjacent values are antithetic: out[2i + 1] = -out[2i]. Paths 2i and 2i + 1
+     * of a batch therefore use opposite draws at every step (an odd last value is a plain draw).
+     */
+    bool antithetic = false;
+
+    /**
+     * @brief Each buffer is shifted and scaled to sample mean 0 and sample variance 1
+     * (moment matching). Buffers of fewer than two values are left as drawn.
+     */
+    bool moment_matching = false;
+};
 
 /**
  * @brief Utility class for generating random numbers.
  * * Uses the Mersenne Twister engine and a normal distribution for standard normal variables.
  * * Implemented as a Singleton for easy, global access across the simulation, 
  * ensuring consistent random number generation.
+ * * There is one instance per thread, so engines running concurrently (async jobs,
+ * thread pools) never share a generator state.
  */
 class RNG {
 
     public:
 
         /**
-         * @brief Provides the single instance of the RNG class.
+         * @brief Provides the instance of the RNG class owned by the calling thread.
          */
         static RNG& getInstance();
      
@@ -24,11 +53,82 @@ class RNG {
          */
         double getStandardNormal();
 
+        /**
+         * @brief Fills a buffer with N(0, 1) draws.
+         * * The draws are independent unless a SamplingScheme is set (see setSampling).
+         * @param out Destination buffer.
+         * @param n Number of draws.
+         */
+        void fillStandardNormal(double* out, std::size_t n);
+
+        /**
+         * @brief Fills a buffer with independent N(0, 1) draws in single precision.
+         * * Each uniform of the polar method takes one 32-bit output of the engine
+         * instead of two, so a float draw costs about half a double draw. The
+         * sequence differs from the double one for the same seed. The SamplingScheme applies.
+         * @param out Destination buffer.
+         * @param n Number of draws.
+         */
+        void fillStandardNormal(float* out, std::size_t n);
+
+        /**
+         * @brief Generates a random number uniformly distributed in the open interval (0, 1).
+         */
+        double getUniform();
+
+        /**
+         * @brief Fills a buffer with independent Poisson(mean) counts.
+         * * Inversion of the CDF from one uniform u = Phi(z) per draw, z drawn by
+         * fillStandardNormal() so that the SamplingScheme applies (antithetic counts come
+         * from u and 1 - u). Intended for small means (jumps per time step), where
+         * z almost always falls below Phi^-1(exp(-mean)) and the count is 0 at once.
+         * @param out Destination buffer (counts stored as doubles, ready for SoA arithmetic).
+         * @param n Number of draws.
+         * @param mean The Poisson intensity (lambda * dt), must be >= 0.
+         */
+        void fillPoisson(double* out, std::size_t n, double mean);
+
+        /**
+         * @brief Re-seeds the generator deterministically.
+         * * Each (seed, stream) pair is expanded through std::seed_seq into a full
+         * Mersenne Twister state, so distinct stream ids give statistically
+         * independent sequences. Used to give every batch/shard its own stream.
+         * @param seed The base seed of the run.
+         * @param stream The stream identifier (e.g. the batch index).
+         */
+        void seed(std::uint64_t seed, std::uint64_t stream = 0);
+
+        /**
+         * @brief Sets the variance-reduction scheme of the buffers filled by this thread's
+         * generator (fillStandardNormal and fillPoisson). Scalar draws (getStandardNormal,
+         * getUniform) are never affected, so models draw through the buffers.
+         */
+        void setSampling(const SamplingScheme& scheme) { sampling = scheme; }
+
+        const SamplingScheme& getSampling() const { return sampling; }
+
+        /**
+         * @brief Sets a SamplingScheme for the lifetime of the scope, then restores the previous one.
+         */
+        class SamplingScope {
+            public:
+                SamplingScope(RNG& rng_in, const SamplingScheme& scheme)
+                    : rng(rng_in), previous(rng_in.getSampling()) { rng.setSampling(scheme); }
+                ~SamplingScope() { rng.setSampling(previous); }
+
+                SamplingScope(const SamplingScope&) = delete;
+                SamplingScope& operator=(const SamplingScope&) = delete;
+
+            private:
+                RNG& rng;
+                SamplingScheme previous;
+        };
+
     private:
 
         /**
          * @brief Private Constructor (ensures only one instance can be created).
-         * Initializes the random engine and distribution.
+         * Initializes the random engine (seeded from the clock and the thread id) and distribution.
          */
         RNG();
         
@@ -40,6 +140,21 @@ class RNG {
 
         // Normal Distribution for N(0, 1)
         std::normal_distribution<double> normal_dist;
+
+        // Single-precision N(0, 1) (reduced-precision simulation)
+        std::normal_distribution<float> normal_dist_float;
+
+        // Uniform Distribution on [0, 1) (zero is rejected in getUniform)
+        std::uniform_real_distribution<double> uniform_dist;
+
+        // Variance reduction of the filled buffers (none by default)
+        SamplingScheme sampling;
+
+        /**
+         * @brief Fills out with draws of dist according to the sampling scheme.
+         */
+        template <typename Real, typename Distribution>
+        void fillNormals(Real* out, std::size_t n, Distribution& dist);
 };
 
 #endif 
\ No newline at end of file
@@ -0,0 +1,81 @@
+#ifndef TERMSTRUCTUREGBM_HPP
+#define TERMSTRUCTUREGBM_HPP
+
+#include "AssetModel.hpp"
+#include "Curve.hpp"
+#include <vector>
+
+/**
+ * @brief GBM with time-dependent rate and volatility curves.
+ * * dS/S = r(t) dt + sigma(t) dW. Over each step [t_i, t_{i+1}] the log-increment is
+ * exactly N(int r - 0.5 int sigma^2, int sigma^2), so the per-step drift and
+ * diffusion coefficients are integrated once from the curves and stored in
+ * contiguous tables. The simulation loop then reads two doubles per step,
+ * exactly like the constant GBM.
+ * * The tables are built in the constructor for the pricing horizon; a call with a
+ * different maturity rebuilds them locally (correct, but slower).
+ */
+class TermStructureGBM : public AssetModel {
+
+    public:
+
+        /**
+         * @brief Constructs the model and precomputes the step tables.
+         * @param S0_in Initial asset price.
+         * @param steps_in Number of time steps.
+         * @param rate_in Short-rate (drift) curve.
+         * @param vol_in Volatility curve.
+         * @param horizon_in Maturity the step tables are built for (usually option.getT()).
+         */
+        TermStructureGBM(double S0_in, int steps_in, const Curve& rate_in, const Curve& vol_in,
+                         double horizon_in);
+
+        /**
+         * @brief Generates a single Path of prices.
+         * @param T The time to maturity.
+         * @return The simulated Path object.
+         */
+        Path generatePath(double T) const override;
+
+        /**
+         * @brief Generates a batch of paths, one time step at a time across all paths.
+         * @param T The time to maturity.
+         * @param batch The destination batch (num_paths x getSteps()).
+         */
+        void generatePathBatch(double T, PathBatch& batch) const override;
+
+        const Curve& getRateCurve() const { return rate; }
+
+        /**
+         * @brief exp(-int_0^T r(t) dt) from the rate curve; the option's flat r is ignored.
+         */
+        double getDiscountFactor(double T, double r) const override;
+        const Curve& getVolCurve() const { return vol; }
+
+        std::string getName() const override { return "TermStructureGBM"; }
+
+        /**
+         * @brief S0, steps, then the knots of the rate and volatility curves.
+         */
+        std::vector<double> getParameters() const override;
+        double getHorizon() const { return tables.horizon; }
+
+    private:
+
+        /**
+         * @brief Per-step coefficients for one maturity.
+         */
+        struct StepTables {
+            double horizon = 0.0;
+            std::vector<double> drift;       // int r - 0.5 * int sigma^2 over each step
+            std::vector<double> diffusion;   // sqrt(int sigma^2) over each step
+        };
+
+        StepTables buildTables(double T) const;
+
+        Curve rate;
+        Curve vol;
+        StepTables tables;   // precomputed for the construction horizon
+};
+
+#endif
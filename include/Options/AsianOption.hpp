@@ -28,6 +28,8 @@ class AsianOption : public EuropeanOption {
          */
         double payoff(const Path& path) const override;
 
+        std::string getName() const override { return "AsianOption"; }
+
     };
 
 #endif 
\ No newline at end of file
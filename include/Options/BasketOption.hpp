@@ -0,0 +1,47 @@
+#ifndef BASKETOPTION_HPP
+#define BASKETOPTION_HPP
+
+#include "EuropeanOption.hpp"
+#include <vector>
+
+/**
+ * @brief Represents a European Basket Call Option on several underlyings.
+ * Payoff = max(sum_i w_i * S_i(T) - K, 0), priced with a multi-asset model
+ * (e.g. MultiAssetGBM).
+ */
+class BasketOption : public EuropeanOption {
+
+    public:
+        /**
+         * @brief Constructor for the Basket Option.
+         * @param T_in Time to maturity.
+         * @param r_in Risk-free rate.
+         * @param K_in Strike price.
+         * @param weights_in Weight of each asset in the basket.
+         * @throw std::invalid_argument If weights_in is empty.
+         */
+        BasketOption(double T_in, double r_in, double K_in, const std::vector<double>& weights_in);
+
+        /**
+         * @brief Calculates the option's payoff at maturity.
+         * @param path The simulated multi-asset path (one series per weight).
+         * @return The raw (undiscounted) payoff value.
+         * @throw std::invalid_argument If the path does not have one asset per weight.
+         */
+        double payoff(const Path& path) const override;
+
+        const std::vector<double>& getWeights() const { return weights; }
+
+        std::string getName() const override { return "BasketOption"; }
+
+        /**
+         * @brief T, r, K, then the weights.
+         */
+        std::vector<double> getParameters() const override;
+
+    private:
+
+        std::vector<double> weights;
+};
+
+#endif // BASKETOPTION_HPP
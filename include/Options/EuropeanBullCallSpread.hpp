@@ -28,6 +28,9 @@ public:
      */
     double payoff(const Path& path) const override;
 
+    std::string getName() const override { return "CallSpread"; }
+    std::vector<double> getParameters() const override { return {T, r, K1, K2}; }
+
 private:
     double K1; // Strike of the bought Call (K_low)
     double K2; // Strike of the sold Call (K_high)
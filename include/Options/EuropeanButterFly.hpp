@@ -31,6 +31,9 @@ class EuropeanButterFly : public Option {
          */
         double payoff(const Path& path) const override;
 
+        std::string getName() const override { return "EuropeanButterFly"; }
+        std::vector<double> getParameters() const override { return {T, r, K1, K2, K3}; }
+
     private:
 
         double K1;
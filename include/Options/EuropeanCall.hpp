@@ -30,6 +30,8 @@ class EuropeanCall : public EuropeanOption, public AnalyticPriced {
          */
         double payoff(const Path& path) const override;
 
+        std::string getName() const override { return "EuropeanCall"; }
+
         /** 
          * @brief Calculates the analytical Delta using the Black-Scholes formula.
          * @param S Current asset price.
@@ -40,6 +40,8 @@ class EuropeanOption : public Option {
          * @return The strike price K.
          */
         double getK() const { return K; }
+
+        std::vector<double> getParameters() const override { return {T, r, K}; }
         
 };
 
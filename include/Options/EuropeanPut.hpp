@@ -26,6 +26,8 @@ class EuropeanPut : public EuropeanOption {
          * @return The raw (undiscounted) gain at maturity.
          */
         double payoff(const Path& path) const override;
+
+        std::string getName() const override { return "EuropeanPut"; }
     };
 
 #endif 
\ No newline at end of file
@@ -0,0 +1,44 @@
+#ifndef RAINBOWOPTION_HPP
+#define RAINBOWOPTION_HPP
+
+#include "EuropeanOption.hpp"
+
+/**
+ * @brief Represents a European Rainbow Call Option (best-of or worst-of).
+ * Payoff = max(max_i S_i(T) - K, 0) for BestOf, max(min_i S_i(T) - K, 0) for WorstOf.
+ */
+class RainbowOption : public EuropeanOption {
+
+    public:
+
+        enum class Type { BestOf, WorstOf };
+
+        /**
+         * @brief Constructor for the Rainbow Option.
+         * @param T_in Time to maturity.
+         * @param r_in Risk-free rate.
+         * @param K_in Strike price.
+         * @param type_in BestOf (call on the maximum) or WorstOf (call on the minimum).
+         */
+        RainbowOption(double T_in, double r_in, double K_in, Type type_in);
+
+        /**
+         * @brief Calculates the option's payoff at maturity from the final price of every asset.
+         * @param path The simulated multi-asset path.
+         * @return The raw (undiscounted) payoff value.
+         */
+        double payoff(const Path& path) const override;
+
+        Type getType() const { return type; }
+
+        std::string getName() const override { return "RainbowOption"; }
+        std::vector<double> getParameters() const override {
+            return {T, r, K, type == Type::BestOf ? 0.0 : 1.0};
+        }
+
+    private:
+
+        Type type;
+};
+
+#endif // RAINBOWOPTION_HPP
@@ -0,0 +1,124 @@
+#ifndef ADAPTIVEPRICING_HPP
+#define ADAPTIVEPRICING_HPP
+
+#include "PricingResult.hpp"
+#include <vector>
+
+/**
+ * @brief Reason why an adaptive Monte Carlo run stopped generating paths.
+ */
+enum class StopReason {
+    TargetAbsoluteError,   // standard_error <= target_absolute_error
+    TargetRelativeError,   // standard_error <= target_relative_error * |price|
+    TimeBudget,            // the wall-clock budget has been consumed
+    MaxPaths,              // the hard cap on the number of paths has been reached
+    Cancelled              // the progress callback requested a cancellation
+};
+
+/**
+ * @brief Returns a short human-readable label for a StopReason.
+ */
+inline const char* toString(StopReason reason) {
+    switch (reason) {
+        case StopReason::TargetAbsoluteError: return "target absolute error";
+        case StopReason::TargetRelativeError: return "target relative error";
+        case StopReason::TimeBudget:          return "time budget";
+        case StopReason::MaxPaths:            return "max paths";
+        case StopReason::Cancelled:           return "cancelled";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Stopping rules for MonteCarloPricer::calculatePriceAdaptive.
+ * * Paths are simulated in batches of batch_size. After each batch (and once
+ * min_paths have been simulated) the running standard error is compared to the
+ * enabled targets. A target set to 0 is disabled.
+ */
+struct AdaptiveSettings {
+
+    /**
+     * @brief Stop when the standard error of the price is below this value (0 = disabled).
+     */
+    double target_absolute_error = 0.0;
+
+    /**
+     * @brief Stop when standard_error / |price| is below this value (0 = disabled).
+     */
+    double target_relative_error = 0.0;
+
+    /**
+     * @brief Wall-clock budget in seconds (0 = unlimited).
+     */
+    double time_budget_seconds = 0.0;
+
+    /**
+     * @brief Number of paths simulated between two convergence checks.
+     */
+    int batch_size = 10000;
+
+    /**
+     * @brief Minimum number of paths before any error target may stop the run.
+     * Protects against a meaningless standard error on tiny samples (e.g. deep OTM options).
+     */
+    int min_paths = 1000;
+
+    /**
+     * @brief Hard cap on the total number of paths.
+     */
+    int max_paths = 10000000;
+
+    /**
+     * @brief If true, every realized payoff is kept in the result distribution.
+     */
+    bool keep_distribution = false;
+
+    /**
+     * @brief If true, the payoffs are also added to the quantile sketch of the result
+     * (a checkpoint's sketch is carried over either way).
+     */
+    bool keep_quantiles = false;
+};
+
+/**
+ * @brief PricingResult enriched with the diagnostics of an adaptive run.
+ */
+class AdaptivePricingResult : public PricingResult {
+
+    public:
+
+        /**
+         * @brief Total number of paths actually simulated.
+         */
+        int paths_used;
+
+        /**
+         * @brief Which rule ended the simulation.
+         */
+        StopReason stop_reason;
+
+        /**
+         * @brief Wall-clock time spent in the simulation (seconds).
+         */
+        double elapsed_seconds;
+
+        /**
+         * @brief Builds the result from the statistics accumulated during the run.
+         * paths_used is the number of observations in stats.
+         */
+        AdaptivePricingResult(const PayoffStatistics& stats, double df, const std::vector<double>& dist,
+                              StopReason reason, double elapsed)
+            : PricingResult(stats, df, dist), paths_used(static_cast<int>(stats.getCount())),
+              stop_reason(reason), elapsed_seconds(elapsed) {}
+
+        /**
+         * @brief Same, when an observation is not one path (antithetic pairs).
+         * @param paths Number of paths simulated to build stats.
+         */
+        AdaptivePricingResult(const PayoffStatistics& stats, double df, const std::vector<double>& dist,
+                              StopReason reason, double elapsed, int paths)
+            : PricingResult(stats, df, dist), paths_used(paths),
+              stop_reason(reason), elapsed_seconds(elapsed) {}
+};
+
+#endif
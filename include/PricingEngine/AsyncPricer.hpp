@@ -0,0 +1,178 @@
+#ifndef ASYNCPRICER_HPP
+#define ASYNCPRICER_HPP
+
+#include "../Core/Option.hpp"
+#include "../Models/AssetModel.hpp"
+#include "../Models/GBM.hpp"
+#include "AdaptivePricing.hpp"
+#include "GreeksPricer.hpp"
+#include "PricingExecutor.hpp"
+#include "PricingProgress.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+
+/**
+ * @brief Future-like handle on a pricing running on a PricingExecutor.
+ * * The handle is cheap to copy (shared state). cancel() is cooperative: the
+ * engine stops at its next batch/time-step boundary, after which get() throws
+ * PricingCancelled. getProgress() returns the last interim quote reported.
+ * @tparam T The result type of the pricing.
+ */
+template <typename T>
+class PricingJob {
+
+    public:
+
+        /**
+         * @brief State shared between the handle and the task running the pricing.
+         */
+        struct State {
+            std::promise<T> promise;
+            std::shared_future<T> future;
+            std::atomic<bool> cancel_requested{false};
+            mutable std::mutex progress_mutex;
+            PricingProgress last_progress;
+            ProgressCallback user_callback;
+        };
+
+        explicit PricingJob(std::shared_ptr<State> state_in) : state(std::move(state_in)) {}
+
+        /**
+         * @brief Requests a cooperative cancellation.
+         */
+        void cancel() { state->cancel_requested = true; }
+
+        /**
+         * @brief True once cancel() has been called (the job may still be finishing its batch).
+         */
+        bool isCancelRequested() const { return state->cancel_requested; }
+
+        /**
+         * @brief True if the result (or the error) is available.
+         */
+        bool isReady() const {
+            return state->future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }
+
+        /**
+         * @brief Blocks until the job has finished.
+         */
+        void wait() const { state->future.wait(); }
+
+        /**
+         * @brief Blocks at most timeout.
+         * @return True if the job has finished.
+         */
+        template <typename Rep, typename Period>
+        bool waitFor(const std::chrono::duration<Rep, Period>& timeout) const {
+            return state->future.wait_for(timeout) == std::future_status::ready;
+        }
+
+        /**
+         * @brief Waits for and returns the result.
+         * @throw PricingCancelled If the job was cancelled, or any exception thrown by the engine.
+         */
+        T get() const { return state->future.get(); }
+
+        /**
+         * @brief Last interim quote reported by the engine.
+         */
+        PricingProgress getProgress() const {
+            std::lock_guard<std::mutex> lock(state->progress_mutex);
+            return state->last_progress;
+        }
+
+    private:
+
+        std::shared_ptr<State> state;
+};
+
+/**
+ * @brief Asynchronous front-end for the pricing engines.
+ * * Every submit method returns immediately with a PricingJob; the pricing runs on
+ * the executor and reports its interim price/standard error at batch boundaries
+ * through the optional callback (called on the executor thread, returning false
+ * cancels). The option and model are taken by reference and must outlive the job.
+ */
+class AsyncPricer {
+
+    public:
+
+        /**
+         * @brief Creates a front-end submitting to the given executor.
+         * @param executor_in The thread pool (the process-wide one by default).
+         */
+        explicit AsyncPricer(PricingExecutor& executor_in = PricingExecutor::shared());
+
+        /**
+         * @brief Monte Carlo pricing in batches (see MonteCarloPricer::calculatePriceAdaptive).
+         * A fixed-size run is obtained with max_paths = N and no error target.
+         */
+        PricingJob<AdaptivePricingResult> submitMonteCarlo(const Option& option, const AssetModel& model,
+                                                           const AdaptiveSettings& settings,
+                                                           ProgressCallback on_progress = nullptr);
+
+        /**
+         * @brief Delta and Gamma by finite differences (see GreeksPricer::calculateDeltaGamma).
+         */
+        PricingJob<GreeksResult> submitGreeks(const Option& option, const AssetModel& model,
+                                              int num_simulations, double epsilon,
+                                              ProgressCallback on_progress = nullptr);
+
+        /**
+         * @brief PDE price at S0 (see EDPSolver::solve).
+         */
+        PricingJob<double> submitEDP(const Option& option, const GBM& model,
+                                     double S_max, int M, int N,
+                                     ProgressCallback on_progress = nullptr);
+
+    private:
+
+        PricingExecutor& executor;
+
+        /**
+         * @brief Wraps an engine call into a job: installs the progress/cancellation
+         * observer, runs it on the executor and fulfils the promise.
+         * @param engine The pricing, receiving the observer to pass to the engine.
+         * @param on_progress The user callback.
+         */
+        template <typename T, typename Engine>
+        PricingJob<T> launch(Engine engine, ProgressCallback on_progress) {
+
+            auto state = std::make_shared<typename PricingJob<T>::State>();
+            state->future = state->promise.get_future().share();
+            state->user_callback = std::move(on_progress);
+
+            executor.submit([state, engine]() {
+                if (state->cancel_requested) {
+                    state->promise.set_exception(std::make_exception_ptr(PricingCancelled()));
+                    return;
+                }
+
+                ProgressCallback observer = [state](const PricingProgress& progress) {
+                    {
+                        std::lock_guard<std::mutex> lock(state->progress_mutex);
+                        state->last_progress = progress;
+                    }
+                    if (state->user_callback && !state->user_callback(progress)) {
+                        state->cancel_requested = true;
+                    }
+                    return !state->cancel_requested.load();
+                };
+
+                try {
+                    state->promise.set_value(engine(observer));
+                } catch (...) {
+                    state->promise.set_exception(std::current_exception());
+                }
+            });
+
+            return PricingJob<T>(state);
+        }
+};
+
+#endif
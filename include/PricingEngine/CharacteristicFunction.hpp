@@ -0,0 +1,93 @@
+#ifndef CHARACTERISTICFUNCTION_HPP
+#define CHARACTERISTICFUNCTION_HPP
+
+#include <complex>
+#include <memory>
+
+class AssetModel;
+
+/**
+ * @brief Characteristic function of the log-return X_T = ln(S_T / S0) of a model.
+ * * phi(u) = E[exp(i * u * X_T)], defined for complex u (Carr-Madan evaluates it
+ * below the real axis). It is all the Fourier pricers need to know about a model.
+ */
+class CharacteristicFunction {
+
+    public:
+
+        virtual ~CharacteristicFunction() = default;
+
+        /**
+         * @brief Evaluates phi(u) for the horizon T.
+         */
+        virtual std::complex<double> operator()(std::complex<double> u, double T) const = 0;
+
+        /**
+         * @brief First two cumulants (mean and variance) of X_T, used to size the COS interval.
+         * * The default implementation differentiates log(phi) numerically at u = 0.
+         */
+        virtual void cumulants(double T, double& c1, double& c2) const;
+
+        /**
+         * @brief Builds the characteristic function of a supported model (GBM, Heston, Merton).
+         * The model drift is used as the risk-neutral rate.
+         * @return The characteristic function, or nullptr if the model has none here.
+         */
+        static std::unique_ptr<CharacteristicFunction> fromModel(const AssetModel& model);
+};
+
+/**
+ * @brief Black-Scholes (GBM): X_T ~ N((r - sigma^2/2) T, sigma^2 T).
+ */
+class GBMCharacteristicFunction : public CharacteristicFunction {
+
+    public:
+
+        GBMCharacteristicFunction(double r_in, double sigma_in) : r(r_in), sigma(sigma_in) {}
+
+        std::complex<double> operator()(std::complex<double> u, double T) const override;
+        void cumulants(double T, double& c1, double& c2) const override;
+
+    private:
+
+        double r;
+        double sigma;
+};
+
+/**
+ * @brief Heston, in the "little trap" formulation (continuous in u, no branch cut issue).
+ */
+class HestonCharacteristicFunction : public CharacteristicFunction {
+
+    public:
+
+        HestonCharacteristicFunction(double r_in, double v0_in, double kappa_in, double theta_in,
+                                     double xi_in, double rho_in)
+            : r(r_in), v0(v0_in), kappa(kappa_in), theta(theta_in), xi(xi_in), rho(rho_in) {}
+
+        std::complex<double> operator()(std::complex<double> u, double T) const override;
+
+    private:
+
+        double r, v0, kappa, theta, xi, rho;
+};
+
+/**
+ * @brief Merton jump-diffusion: GBM part times a compound Poisson of lognormal jumps.
+ */
+class MertonCharacteristicFunction : public CharacteristicFunction {
+
+    public:
+
+        MertonCharacteristicFunction(double r_in, double sigma_in, double lambda_in,
+                                     double jump_mean_in, double jump_vol_in)
+            : r(r_in), sigma(sigma_in), lambda(lambda_in), jump_mean(jump_mean_in), jump_vol(jump_vol_in) {}
+
+        std::complex<double> operator()(std::complex<double> u, double T) const override;
+
+    private:
+
+        double r, sigma, lambda, jump_mean, jump_vol;
+};
+
+#endif
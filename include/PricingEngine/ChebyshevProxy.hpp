@@ -0,0 +1,123 @@
+#ifndef CHEBYSHEVPROXY_HPP
+#define CHEBYSHEVPROXY_HPP
+
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+class PricingExecutor;
+
+/**
+ * @brief One input of a proxy: an interval and a polynomial degree.
+ */
+struct ChebyshevAxis {
+    double lower;
+    double upper;
+    int degree;   // number of Chebyshev nodes minus one (1..ChebyshevProxy::MAX_DEGREE)
+};
+
+/**
+ * @brief Tensor Chebyshev interpolant of a pricing function of 1 to 3 inputs.
+ * * The engine (Monte Carlo, EDP, lattice...) is sampled once on the tensor grid of
+ * Chebyshev-Lobatto nodes, e.g. over (S0, sigma) or (S0, sigma, T). The fitted
+ * polynomial then gives the price and its derivatives (delta, gamma, vega...) in
+ * a few hundred floating-point operations, without allocation, so repeated
+ * intraday revaluations no longer run the engine.
+ * * Example (fixed seed so that all nodes share the same random numbers):
+ * @code
+ *   auto price = [&](const std::vector<double>& x) {
+ *       RNG::getInstance().seed(42);
+ *       GBM model(x[0], 50, r, x[1]);
+ *       return MonteCarloPricer(asian, model).calculatePrice(100000).price;
+ *   };
+ *   ChebyshevProxy proxy = ChebyshevProxy::build(price, {{80, 120, 16}, {0.1, 0.4, 12}});
+ *   double delta = proxy.derivative({100.0, 0.2}, {1, 0});
+ * @endcode
+ * * Fitted proxies can be saved to disk and reloaded by another process.
+ */
+class ChebyshevProxy {
+
+    public:
+
+        static const std::size_t MAX_DIMENSIONS = 3;
+        static const int MAX_DEGREE = 64;
+
+        /**
+         * @brief Samples the function on the Chebyshev nodes and fits the coefficients.
+         * @param function The pricing function; receives one value per axis.
+         * @param axes The input intervals and degrees (1 to 3 axes).
+         * @param executor Optional thread pool: the nodes are then priced concurrently
+         *                 (the function must be thread-safe). When build() is called from
+         *                 a task of that same pool, the nodes are priced inline instead.
+         *                 If a node throws, the first exception is rethrown once every
+         *                 node task has finished.
+         * @return The fitted proxy.
+         * @throw std::invalid_argument If the axes are invalid.
+         */
+        static ChebyshevProxy build(const std::function<double(const std::vector<double>&)>& function,
+                                    const std::vector<ChebyshevAxis>& axes,
+                                    PricingExecutor* executor = nullptr);
+
+        /**
+         * @brief Interpolated value at a point (one coordinate per axis).
+         * @throw std::out_of_range If the point lies outside the fitted domain.
+         */
+        double evaluate(const double* point) const;
+        double evaluate(const std::vector<double>& point) const { return evaluate(point.data()); }
+
+        /**
+         * @brief Partial derivative of the interpolant (e.g. {1, 0} = delta, {2, 0} = gamma,
+         * {1, 1} = cross derivative).
+         * @param point One coordinate per axis.
+         * @param orders Derivative order per axis (0, 1 or 2).
+         * @throw std::invalid_argument If an order is not 0, 1 or 2.
+         */
+        double derivative(const double* point, const int* orders) const;
+        double derivative(const std::vector<double>& point, const std::vector<int>& orders) const;
+
+        /**
+         * @brief A priori error estimate: sum of the magnitudes of the last two coefficient
+         * layers along every axis (the series converges geometrically for smooth prices).
+         */
+        double getErrorEstimate() const { return error_estimate; }
+
+        /**
+         * @brief A posteriori error: maximum absolute difference with the function at
+         * num_points pseudo-random points of the domain (deterministic sequence).
+         */
+        double measureError(const std::function<double(const std::vector<double>&)>& function,
+                            int num_points) const;
+
+        std::size_t getNumDimensions() const { return axes.size(); }
+        const std::vector<ChebyshevAxis>& getAxes() const { return axes; }
+        const std::vector<double>& getCoefficients() const { return coefficients; }
+
+        /**
+         * @brief Binary serialization (little-endian, see BinaryIO).
+         */
+        void writeBinary(std::ostream& os) const;
+        static ChebyshevProxy readBinary(std::istream& is);
+
+        /**
+         * @brief Saves / loads the proxy to / from a file.
+         * @throw std::runtime_error If the file cannot be opened or is invalid.
+         */
+        void save(const std::string& filename) const;
+        static ChebyshevProxy load(const std::string& filename);
+
+    private:
+
+        ChebyshevProxy() = default;
+
+        /**
+         * @brief Tensor sum of the coefficients against per-axis basis values T_k^(order)(x).
+         */
+        double contract(const double* point, const int* orders) const;
+
+        std::vector<ChebyshevAxis> axes;
+        std::vector<double> coefficients;   // row-major, last axis fastest
+        double error_estimate = 0.0;
+};
+
+#endif
@@ -3,6 +3,7 @@
 
 #include "../Core/Option.hpp"
 #include "../Models/GBM.hpp"
+#include "PricingProgress.hpp"
 #include <vector>
 
 /**
@@ -20,16 +21,22 @@ public:
      * @param S_max Prix maximum pour la grille (souvent 2*K ou 3*K)
      * @param M Nombre de pas d'espace
      * @param N Nombre de pas de temps
+     * @param on_progress Observateur optionnel appelé toutes les ~N/100 itérations en temps
+     *                    avec le prix courant en S0 ; renvoyer false annule le calcul.
      * @return Le prix calculé à S0
+     * @throw PricingCancelled Si l'observateur a annulé le calcul.
      */
-    double solve(double S_max, int M, int N) const;
+    double solve(double S_max, int M, int N, const ProgressCallback& on_progress = nullptr) const;
 
 
     /**
      * @brief Calcule la courbe complète du prix de l'option par rapport à S.
+     * @param on_progress Observateur optionnel (voir solve).
      * @return Une paire contenant le vecteur des prix S et le vecteur des valeurs V.
+     * @throw PricingCancelled Si l'observateur a annulé le calcul.
      */
-    std::pair<std::vector<double>, std::vector<double>> calculateEDPCurve(double S_max, int M, int N) const;
+    std::pair<std::vector<double>, std::vector<double>> calculateEDPCurve(double S_max, int M, int N,
+                                                                          const ProgressCallback& on_progress = nullptr) const;
 
 private:
 
@@ -0,0 +1,87 @@
+#ifndef FOURIERPRICER_HPP
+#define FOURIERPRICER_HPP
+
+#include <memory>
+#include <vector>
+
+#include "CharacteristicFunction.hpp"
+
+class Option;
+class AssetModel;
+
+/**
+ * @brief Fourier pricing engine for European calls and puts on a whole strike grid.
+ * * COS method (Fang & Oosterlee): the density of the log-return is expanded in a
+ * cosine series on a truncated interval. The characteristic function values and
+ * the payoff coefficients do not depend on the strike, so they are computed once
+ * per maturity and every strike only costs an N-term sum.
+ * * Carr-Madan FFT: the damped call price is the Fourier transform of a function
+ * of phi, and one FFT gives the prices on a whole log-strike grid (interpolated
+ * linearly to the requested strikes).
+ * * Works for any model exposing a CharacteristicFunction (GBM, Heston, Merton):
+ * a reference and fast path for vanillas, where Monte Carlo or the EDP solver
+ * need one full run per strike.
+ */
+class FourierPricer {
+
+    public:
+
+        /**
+         * @brief Builds the pricer from a supported model (see CharacteristicFunction::fromModel).
+         * @param model The asset model.
+         * @throw std::invalid_argument If the model has no characteristic function.
+         */
+        explicit FourierPricer(const AssetModel& model);
+
+        /**
+         * @brief Builds the pricer from an explicit characteristic function.
+         * @param cf_in The characteristic function of ln(S_T / S0).
+         * @param S0_in The initial spot.
+         */
+        FourierPricer(std::shared_ptr<const CharacteristicFunction> cf_in, double S0_in);
+
+        /**
+         * @brief COS prices of a strike grid (puts are priced directly, calls by put-call parity).
+         * @param strikes The strikes.
+         * @param T Time to maturity.
+         * @param r Discount rate.
+         * @param is_call true for calls, false for puts.
+         * @param num_terms Number of cosine terms N.
+         * @param truncation Width L of the interval, in standard deviations of ln(S_T / S0).
+         * @return One price per strike.
+         */
+        std::vector<double> priceCOS(const std::vector<double>& strikes, double T, double r, bool is_call,
+                                     int num_terms = 256, double truncation = 12.0) const;
+
+        /**
+         * @brief Carr-Madan FFT call prices of a strike grid.
+         * @param strikes The strikes (must fall inside the FFT log-strike grid).
+         * @param T Time to maturity.
+         * @param r Discount rate.
+         * @param fft_size Number of FFT points (power of two).
+         * @param eta Integration step in the Fourier variable.
+         * @param alpha Damping exponent of the call price (alpha > 0).
+         * @return One call price per strike.
+         */
+        std::vector<double> priceCallsFFT(const std::vector<double>& strikes, double T, double r,
+                                          int fft_size = 4096, double eta = 0.25, double alpha = 1.5) const;
+
+        /**
+         * @brief Price of one vanilla option (COS method): the dispatch entry point.
+         * @param option A EuropeanCall or EuropeanPut.
+         * @throw std::invalid_argument If the option is not a vanilla call or put.
+         */
+        double price(const Option& option) const;
+
+        /**
+         * @brief Tells whether price(option) is available for this option and model.
+         */
+        static bool supports(const Option& option, const AssetModel& model);
+
+    private:
+
+        std::shared_ptr<const CharacteristicFunction> cf;
+        double S0;
+};
+
+#endif
@@ -4,6 +4,15 @@
 #include "../Core/Option.hpp"
 #include "../Models/AssetModel.hpp"
 #include "MonteCarloPricer.hpp"
+#include "PricingProgress.hpp"
+
+/**
+ * @brief Delta and Gamma estimated from the same three bumped pricings.
+ */
+struct GreeksResult {
+    double delta;
+    double gamma;
+};
 
 /**
  * @brief Utility class to calculate option Greeks (Delta, Gamma, Vega, etc.) 
@@ -38,6 +47,20 @@ class GreeksPricer {
          * @return The estimated Gamma value.
          */
         double calculateGamma(int num_simulations, double epsilon) const;
+
+        /**
+         * @brief Estimates Delta and Gamma together from V(S - epsilon), V(S) and V(S + epsilon).
+         * * Three pricing runs instead of the five needed by calculateDelta + calculateGamma.
+         * @param num_simulations Number of paths for each pricing run.
+         * @param epsilon The small perturbation in the initial price S0 (dS).
+         * @param on_progress Optional observer called at batch boundaries. The reported price
+         *                    is the interim price of the bump being simulated; returning false
+         *                    cancels the computation.
+         * @return Delta and Gamma.
+         * @throw PricingCancelled If the observer cancelled the computation.
+         */
+        GreeksResult calculateDeltaGamma(int num_simulations, double epsilon,
+                                         const ProgressCallback& on_progress = nullptr) const;
         
     private:
 
@@ -49,9 +72,12 @@ class GreeksPricer {
          * * This helper handles the creation of the perturbed AssetModel instance.
          * @param S_new The perturbed initial asset price.
          * @param num_simulations Number of paths for the pricing run.
+         * @param on_progress Optional observer forwarded to the Monte Carlo run.
          * @return The estimated price V at S_new.
+         * @throw PricingCancelled If the observer cancelled the run.
          */
-        double getPriceAtS(double S_new, int num_simulations) const;
+        double getPriceAtS(double S_new, int num_simulations,
+                           const ProgressCallback& on_progress = nullptr) const;
 
     };
 
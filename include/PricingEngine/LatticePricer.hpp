@@ -0,0 +1,91 @@
+#ifndef LATTICEPRICER_HPP
+#define LATTICEPRICER_HPP
+
+#include "../Core/Option.hpp"
+#include "../Models/GBM.hpp"
+#include <vector>
+
+/**
+ * @brief Tree construction.
+ */
+enum class LatticeType {
+    CRR,            // Cox-Ross-Rubinstein binomial tree (u = exp(sigma*sqrt(dt)), d = 1/u)
+    LeisenReimer,   // Leisen-Reimer binomial tree (Peizer-Pratt inversion, odd number of steps)
+    Trinomial       // Boyle trinomial tree (u = exp(sigma*sqrt(2*dt)), middle branch flat)
+};
+
+/**
+ * @brief When the holder may exercise.
+ */
+enum class ExerciseStyle {
+    European,   // at maturity only
+    American,   // at every node
+    Bermudan    // at the dates of LatticeSettings::exercise_times (and at maturity)
+};
+
+/**
+ * @brief Parameters of a lattice run.
+ */
+struct LatticeSettings {
+    LatticeType type = LatticeType::CRR;
+    ExerciseStyle exercise = ExerciseStyle::European;
+
+    // Bermudan exercise dates (in years), each mapped to the nearest time step
+    std::vector<double> exercise_times;
+
+    // Combines the prices with N and N/2 steps to cancel the leading error term
+    // (order 1 for CRR and trinomial trees, order 2 for Leisen-Reimer)
+    bool richardson = false;
+};
+
+/**
+ * @brief Binomial/trinomial lattice pricer under the GBM (Black-Scholes) model.
+ * * Backward induction runs in a single rolling buffer (O(N) memory): on a
+ * recombining tree, the value of node j at step i only needs nodes j..j+2 of
+ * step i+1, so the buffer is overwritten in place from the bottom node up.
+ * * Exercise values come from the Option hierarchy: option.payoff() is evaluated
+ * on a one-point Path holding the node price (the same convention as EDPSolver),
+ * so only payoffs depending on the final price are meaningful on a lattice.
+ * * A ladder (several options sharing T and r, e.g. a strike ladder) is priced in one
+ * pass: the buffer stores the lanes of every node contiguously, so the induction
+ * loop over the lanes is vectorized by the compiler.
+ */
+class LatticePricer {
+
+    public:
+
+        /**
+         * @brief Constructor.
+         * @param option_in The option to price.
+         * @param model_in The GBM model (S0 and sigma; the option rate is the risk-neutral drift).
+         */
+        LatticePricer(const Option& option_in, const GBM& model_in);
+
+        /**
+         * @brief Prices the option on a tree of the given number of steps.
+         * @param steps Number of time steps N (rounded up to an odd number for Leisen-Reimer).
+         * @param settings Tree type, exercise style and extrapolation.
+         * @return The price at S0.
+         * @throw std::invalid_argument If steps < 2.
+         */
+        double calculatePrice(int steps, const LatticeSettings& settings = LatticeSettings()) const;
+
+        /**
+         * @brief Prices several options on the same tree geometry in one pass.
+         * @param options The options (same maturity and rate).
+         * @param model The GBM model.
+         * @param steps Number of time steps.
+         * @param settings Tree type, exercise style and extrapolation.
+         * @return One price per option.
+         * @throw std::invalid_argument If the options do not share T and r, or steps < 2.
+         */
+        static std::vector<double> calculateLadder(const std::vector<const Option*>& options, const GBM& model,
+                                                   int steps, const LatticeSettings& settings = LatticeSettings());
+
+    private:
+
+        const Option& option;
+        const GBM& model;
+};
+
+#endif
@@ -0,0 +1,120 @@
+#ifndef MLMCPRICER_HPP
+#define MLMCPRICER_HPP
+
+#include "../Core/Option.hpp"
+#include "../Models/GBM.hpp"
+#include "PricingResult.hpp"
+#include <vector>
+
+/**
+ * @brief Diagnostics collected for one level of a Multilevel Monte Carlo run.
+ */
+struct MLMCLevelStats {
+
+    int level;              // Level index l (0 = coarsest)
+    int fine_steps;         // Number of time steps of the fine path on this level
+    long num_paths;         // Number of coupled samples drawn on this level
+    double mean;            // Sample mean of Y_l = P_l - P_{l-1} (undiscounted)
+    double variance;        // Sample variance of Y_l (undiscounted)
+    double cost_per_path;   // Cost of one sample, counted in simulated time steps
+};
+
+/**
+ * @brief PricingResult enriched with the bias and variance diagnostics of an MLMC run.
+ * * standard_error is the statistical error sqrt(sum_l V_l / N_l) of the combined estimator.
+ */
+class MLMCResult : public PricingResult {
+
+    public:
+
+        /**
+         * @brief Estimate of the remaining discretisation bias (discounted) on the finest level.
+         */
+        double bias_estimate;
+
+        /**
+         * @brief Estimated root mean square error: sqrt(standard_error^2 + bias_estimate^2).
+         */
+        double rmse_estimate;
+
+        /**
+         * @brief Total cost of the run, counted in simulated time steps.
+         */
+        double total_cost;
+
+        /**
+         * @brief Fitted weak error rate: |E[Y_l]| ~ 2^(-alpha * l).
+         */
+        double alpha;
+
+        /**
+         * @brief Fitted variance decay rate: V[Y_l] ~ 2^(-beta * l).
+         */
+        double beta;
+
+        /**
+         * @brief False if the finest allowed level was reached before the bias target was met.
+         */
+        bool converged;
+
+        /**
+         * @brief Per-level statistics, from the coarsest (l = 0) to the finest level.
+         */
+        std::vector<MLMCLevelStats> levels;
+
+        MLMCResult(double p, double se)
+            : PricingResult(p, se, {}), bias_estimate(0.0), rmse_estimate(0.0),
+              total_cost(0.0), alpha(0.0), beta(0.0), converged(false) {}
+};
+
+/**
+ * @brief Multilevel Monte Carlo engine (Giles, 2008) for path-dependent options under GBM.
+ * * Level l simulates a fine path with base_steps * 2^l steps coupled with a coarse
+ * path of base_steps * 2^(l-1) steps, both driven by the same Brownian increments
+ * (each coarse increment is the sum of two fine ones). The telescoping sum
+ * E[P_L] = E[P_0] + sum_l E[P_l - P_{l-1}] is estimated level by level, and the
+ * number of samples per level is allocated from on-the-fly variance estimates so
+ * that the total cost for a target RMSE epsilon is close to O(epsilon^-2).
+ */
+class MLMCPricer {
+
+    public:
+
+        /**
+         * @brief Constructs the MLMC pricer.
+         * @param option_in The option to be priced (its payoff is evaluated on each level's path).
+         * @param model_in The GBM model providing S0, mu and sigma. Its number of steps is ignored:
+         *                 the time grids are driven by the levels.
+         */
+        MLMCPricer(const Option& option_in, const GBM& model_in);
+
+        /**
+         * @brief Runs the adaptive MLMC algorithm until the estimated RMSE is below target_rmse.
+         * @param target_rmse Target root mean square error epsilon on the (discounted) price.
+         * @param base_steps Number of time steps of the coarsest level (l = 0).
+         * @param initial_paths Number of pilot samples drawn on each newly added level.
+         * @param min_levels Number of levels used from the start (at least 3 to fit alpha and beta).
+         * @param max_levels Maximum number of levels (the finest has base_steps * 2^(max_levels-1) steps).
+         * @return An MLMCResult with the combined estimate and the bias/variance diagnostics.
+         * @throw std::invalid_argument If the parameters are inconsistent.
+         */
+        MLMCResult calculatePrice(double target_rmse, int base_steps = 1, int initial_paths = 2000,
+                                  int min_levels = 3, int max_levels = 10) const;
+
+    private:
+
+        const Option& option;
+        const GBM& model;
+
+        /**
+         * @brief Draws num_paths coupled samples on a level and adds them to its statistics.
+         * @param level The level index l.
+         * @param base_steps Number of steps of level 0.
+         * @param num_paths Number of samples to draw.
+         * @param stats Running statistics of Y_l (Welford, no catastrophic cancellation).
+         */
+        void sampleLevel(int level, int base_steps, long num_paths,
+                         PayoffStatistics& stats) const;
+};
+
+#endif
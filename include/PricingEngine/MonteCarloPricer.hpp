@@ -4,11 +4,16 @@
 // Inclusion of abstract interfaces and the result structure
 #include "../Core/Option.hpp"
 #include "../Models/AssetModel.hpp"
+#include "../Models/RNG.hpp"
 #include "PricingResult.hpp"
+#include "AdaptivePricing.hpp"
+#include "PricingProgress.hpp"
 
 /**
  * @brief The pricing engine using the Monte Carlo method.
  * It is responsible for executing simulations and calculating the discounted price.
+ * Payoffs are discounted with AssetModel::getDiscountFactor(): the option's flat
+ * rate by default, the model's own rate curve for TermStructureGBM and LocalVolGBM.
  */
 class MonteCarloPricer {
 
@@ -21,25 +26,139 @@ class MonteCarloPricer {
          */
         MonteCarloPricer(const Option& option_in, const AssetModel& model_in);
 
+        /**
+         * @brief Chooses whether calculatePrice() copies every payoff into payoff_distribution.
+         */
+        void setKeepDistribution(bool keep);
+
+        /**
+         * @brief Fills the quantile sketch of the results of calculatePrice() (off by default).
+         * * The sketch gives quantiles, VaR and ES in bounded memory, but sorting the payoffs
+         * costs about as much as a one-step simulation: enable it only when these are read.
+         */
+        void setPayoffQuantiles(bool enable);
+
+        /**
+         * @brief Enables a fixed-bin histogram of the payoffs in the results of this pricer.
+         * @throw std::invalid_argument If upper <= lower or bins <= 0.
+         */
+        void setPayoffHistogram(double lower, double upper, int bins);
+
+        /**
+         * @brief Chooses the scalar type of the simulated paths (Float64 by default).
+         * * With Float32 the paths come from AssetModel::generatePathBatch32 (float draws,
+         * increments and storage); payoffs and statistics stay in double. Applies to
+         * every simulation of this pricer. See the accuracy study (apps/precision_study.cpp).
+         */
+        void setPrecision(SimulationPrecision precision_in);
+
+        /**
+         * @brief Chooses the variance reduction of the normal draws (none by default).
+         * * The scheme is installed on the generator of the simulating thread while the
+         * paths are generated (see SamplingScheme), so it works with every AssetModel,
+         * in the adaptive runs and in worker threads. With antithetic pairs, the
+         * statistics are those of the pair averages (the independent samples). With
+         * moment matching, the standard error still treats the paths as independent;
+         * it is then an upper estimate for payoffs that are monotone in the draws.
+         */
+        void setSampling(const SamplingScheme& scheme);
+
         /**
          * @brief Launches the standard Monte Carlo simulation.
          * @param num_simulations Number of paths to generate.
-         * @return A PricingResult object containing the price, standard error, and distribution.
+         * @return A PricingResult object containing the price, standard error, and distribution
+         *         (the full payoff vector only if setKeepDistribution(true), the default).
          */
         PricingResult calculatePrice(int num_simulations) const;
 
         /**
          * @brief Executes the Monte Carlo simulation using the Antithetic Variates method (Min Var).
-         * * The number of path pairs generated is num_simulations / 2.
+         * * Same as calculatePrice() with antithetic pairing forced on (see setSampling),
+         * for any model. The number of path pairs generated is num_simulations / 2.
          * @param num_simulations The TOTAL number of paths (standard + antithetic). Must be even.
-         * @return A PricingResult object.
+         * @return A PricingResult object: statistics of the pair averages; the distribution,
+         *         sketch and histogram cover all the individual payoffs.
+         */
+        PricingResult calculatePriceMinVar(int num_simulations) const;
+
+        /**
+         * @brief Runs the Monte Carlo simulation in batches until a precision target is met.
+         * * The running mean and variance are updated path by path (Welford), so no
+         * payoff needs to be stored unless settings.keep_distribution is true.
+         * The run stops at the first satisfied rule among: absolute error target,
+         * relative error target, wall-clock budget, and max_paths. min_paths, max_paths and
+         * the reported path counts refer to simulated paths; with antithetic sampling the
+         * batches are rounded to an even size so that a pair never spans two batches.
+         * @param settings The stopping rules (see AdaptiveSettings).
+         * @param on_batch Optional observer called after each batch with the interim
+         *                 price; returning false stops the run with StopReason::Cancelled.
+         * @return An AdaptivePricingResult with the price, the standard error, the
+         *         number of paths used and the reason why the run stopped.
+         * @throw std::invalid_argument If batch_size or max_paths is not positive.
+         */
+        AdaptivePricingResult calculatePriceAdaptive(const AdaptiveSettings& settings,
+                                                     const ProgressCallback& on_batch = nullptr) const;
+
+        /**
+         * @brief Continues an adaptive run from a previous (possibly deserialized) result.
+         * * The checkpoint statistics are merged with the new paths, so the stopping rules
+         * and max_paths apply to the combined sample. The elapsed time only covers this call.
+         * The checkpoint's paths_per_sample gives its path count; it must match the
+         * antithetic setting of this pricer, since pairs and plain payoffs cannot be merged.
+         * @param settings The stopping rules (see AdaptiveSettings).
+         * @param checkpoint A result built from PayoffStatistics for the same option and model.
+         * @param on_batch Optional observer, as in calculatePriceAdaptive.
+         * @return The combined AdaptivePricingResult.
+         * @throw std::invalid_argument If the settings are invalid, or if the discount factors
+         *        or the antithetic settings differ.
+         */
+        AdaptivePricingResult resumePriceAdaptive(const AdaptiveSettings& settings,
+                                                  const PricingResult& checkpoint,
+                                                  const ProgressCallback& on_batch = nullptr) const;
+
+        /**
+         * @brief Simulates num_paths paths and accumulates their payoffs.
+         * * Paths are generated block by block through AssetModel::generatePathBatch
+         * (SoA layout) and each path is copied into one reused Path for the payoff,
+         * so the loop does not allocate once the buffers are sized. The paths are
+         * simulated in the precision and with the sampling scheme of this pricer.
+         * @param num_paths Number of paths to simulate.
+         * @param stats Statistics updated with every (undiscounted) payoff, or with the
+         *              average of each antithetic pair (an odd last path stands alone).
+         * @param realized_payoffs If not null, every payoff is also appended to it.
+         * @param quantiles If not null, every payoff is also added to this sketch.
+         * @param histogram If not null, every payoff is also added to this histogram.
+         */
+        void accumulatePayoffs(int num_paths, PayoffStatistics& stats,
+                               std::vector<double>* realized_payoffs = nullptr,
+                               QuantileSketch* quantiles = nullptr,
+                               FixedHistogram* histogram = nullptr) const;
+
+        /**
+         * @brief Prices several options on the same simulated paths (one portfolio run).
+         * * Each block of paths is generated once and every option evaluates its payoff
+         * on it, so the simulation cost is shared and the prices are computed with
+         * common random numbers.
+         * @param options The options (same maturity).
+         * @param model The simulation model.
+         * @param num_simulations Number of paths.
+         * @param keep_quantiles If true, each result carries the quantile sketch of its payoffs.
+         * @return One PricingResult per option (no payoff vector).
+         * @throw std::invalid_argument If options is empty or the maturities differ.
          */
-        PricingResult calculatePriceMinVar(int num_simulations) const; // <-- New method
+        static std::vector<PricingResult> calculatePortfolioPrices(const std::vector<const Option*>& options,
+                                                                   const AssetModel& model, int num_simulations,
+                                                                   bool keep_quantiles = false);
 
     private:
 
         const Option& option;
         const AssetModel& model;
+        bool keep_distribution = true;
+        bool keep_quantiles = false;
+        FixedHistogram histogram_layout;   // disabled unless setPayoffHistogram() was called
+        SimulationPrecision precision = SimulationPrecision::Float64;
+        SamplingScheme sampling;
 };
 
 #endif
\ No newline at end of file
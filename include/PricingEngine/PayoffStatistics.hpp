@@ -0,0 +1,119 @@
+#ifndef PAYOFFSTATISTICS_HPP
+#define PAYOFFSTATISTICS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+/**
+ * @brief Streaming sufficient statistics of a sample of payoffs.
+ * * Keeps the count, the mean and the central moment sums M2, M3, M4 (plus min/max),
+ * updated one value at a time with the numerically stable recurrences of
+ * Welford / Pébay. Two instances built on disjoint samples can be merged
+ * exactly, which makes partial Monte Carlo runs combinable (checkpoints,
+ * resumed runs, shards executed in other threads or processes).
+ */
+class PayoffStatistics {
+
+    public:
+
+        /**
+         * @brief Creates an empty set of statistics.
+         */
+        PayoffStatistics() = default;
+
+        /**
+         * @brief Adds one observation.
+         * @param x The realized (undiscounted) payoff.
+         */
+        void add(double x);
+
+        /**
+         * @brief Adds a block of observations.
+         * * The block mean is a compensated (Neumaier) sum and its central moments come
+         * from a corrected second pass over the block; the block is then merged as in
+         * merge(). More accurate than n calls to add(), and without a division per value.
+         * @param values The realized (undiscounted) payoffs.
+         * @param n Number of values.
+         */
+        void add(const double* values, std::size_t n);
+
+        /**
+         * @brief Merges the statistics of a disjoint sample into this one.
+         * The result is the same (up to rounding) as if every observation of
+         * other had been passed to add().
+         * @param other The statistics to absorb.
+         */
+        void merge(const PayoffStatistics& other);
+
+        /**
+         * @brief Number of observations.
+         */
+        std::uint64_t getCount() const { return count; }
+
+        /**
+         * @brief Sample mean (0 if empty).
+         */
+        double getMean() const { return mean; }
+
+        /**
+         * @brief Sum of squared deviations from the mean (M2).
+         */
+        double getM2() const { return m2; }
+
+        /**
+         * @brief Unbiased sample variance M2 / (n - 1) (0 if fewer than two observations).
+         */
+        double getVariance() const;
+
+        /**
+         * @brief Standard error of the mean sqrt(variance / n) (0 if fewer than two observations).
+         */
+        double getStandardErrorOfMean() const;
+
+        /**
+         * @brief Sample skewness sqrt(n) * M3 / M2^(3/2) (0 if undefined).
+         */
+        double getSkewness() const;
+
+        /**
+         * @brief Sample excess kurtosis n * M4 / M2^2 - 3 (0 if undefined).
+         */
+        double getExcessKurtosis() const;
+
+        /**
+         * @brief Smallest observation (0 if empty).
+         */
+        double getMin() const { return count ? min_value : 0.0; }
+
+        /**
+         * @brief Largest observation (0 if empty).
+         */
+        double getMax() const { return count ? max_value : 0.0; }
+
+        /**
+         * @brief Writes the statistics in a compact, endianness-independent binary form.
+         * @param os The destination stream (opened in binary mode).
+         */
+        void writeBinary(std::ostream& os) const;
+
+        /**
+         * @brief Reads statistics written by writeBinary().
+         * @param is The source stream (opened in binary mode).
+         * @return The decoded statistics.
+         * @throw std::runtime_error If the stream is truncated.
+         */
+        static PayoffStatistics readBinary(std::istream& is);
+
+    private:
+
+        std::uint64_t count = 0;
+        double mean = 0.0;
+        double m2 = 0.0;        // sum (x - mean)^2
+        double m3 = 0.0;        // sum (x - mean)^3
+        double m4 = 0.0;        // sum (x - mean)^4
+        double min_value = 0.0;
+        double max_value = 0.0;
+};
+
+#endif
@@ -0,0 +1,161 @@
+#ifndef PRICINGCACHE_HPP
+#define PRICINGCACHE_HPP
+
+#include "../Core/Option.hpp"
+#include "../Models/AssetModel.hpp"
+#include "PricingResult.hpp"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class GBM;
+
+/**
+ * @brief Canonical identity of a pricing: engine, option, model and engine settings.
+ * * The key is the exact byte image of the names and of every parameter
+ * (Option::getParameters, AssetModel::getParameters), so two pricings share a
+ * key only if all their inputs are bit-for-bit identical.
+ */
+class PricingKey {
+
+    public:
+
+        /**
+         * @param engine Engine name ("mc", "edp", "analytic"...).
+         * @param option The option (its getName() must not be empty to be cacheable).
+         * @param model The model (same requirement).
+         * @param engine_parameters Engine settings (path count, seed, grid sizes...).
+         */
+        PricingKey(const std::string& engine, const Option& option, const AssetModel& model,
+                   const std::vector<double>& engine_parameters = {});
+
+        /**
+         * @brief False if the option or the model does not describe itself (empty name).
+         */
+        bool isCacheable() const { return cacheable; }
+
+        const std::string& getText() const { return text; }
+        std::uint64_t getHash() const { return hash; }
+
+    private:
+
+        std::string text;
+        std::uint64_t hash = 0;
+        bool cacheable = true;
+};
+
+/**
+ * @brief Bounded, thread-safe cache of pricing results.
+ * * The entries are spread over independent stripes (hash of the key), each one
+ * protected by its own mutex and holding its own LRU list, so concurrent lookups
+ * rarely contend. Each stripe owns an equal share of the memory budget; the
+ * least recently used entries are evicted when it is exceeded (the size of an
+ * entry includes its key and its payoff distribution).
+ * * Only deterministic pricings should be cached: the Monte Carlo front-end seeds
+ * the RNG with the seed of the key before simulating.
+ */
+class PricingCache {
+
+    public:
+
+        /**
+         * @param max_bytes Memory budget of the entries.
+         * @param num_stripes Number of independent stripes (>= 1).
+         */
+        explicit PricingCache(std::size_t max_bytes = 64u << 20, std::size_t num_stripes = 16);
+
+        /**
+         * @brief Looks a key up and marks the entry as recently used.
+         * @return true (and out filled) on a hit.
+         */
+        bool lookup(const PricingKey& key, PricingResult& out);
+
+        /**
+         * @brief Inserts or replaces an entry (ignored if the key is not cacheable or too large).
+         */
+        void insert(const PricingKey& key, const PricingResult& result);
+
+        /**
+         * @brief Returns the cached result, or computes and stores it.
+         * Two threads missing the same key at the same time both compute it.
+         */
+        PricingResult getOrCompute(const PricingKey& key, const std::function<PricingResult()>& compute);
+
+        /**
+         * @brief Cached MonteCarloPricer::calculatePrice with RNG::seed(seed) (no payoff distribution).
+         */
+        PricingResult priceMonteCarlo(const Option& option, const AssetModel& model,
+                                      int num_simulations, std::uint64_t seed);
+
+        /**
+         * @brief Cached EDPSolver::solve.
+         */
+        double priceEDP(const Option& option, const GBM& model, double S_max, int M, int N);
+
+        /**
+         * @brief Cached Black-Scholes price of a EuropeanCall or EuropeanPut.
+         * @throw std::invalid_argument For any other option.
+         */
+        double priceAnalytic(const Option& option, const GBM& model);
+
+        std::uint64_t getHits() const { return hits.load(std::memory_order_relaxed); }
+        std::uint64_t getMisses() const { return misses.load(std::memory_order_relaxed); }
+        std::uint64_t getEvictions() const { return evictions.load(std::memory_order_relaxed); }
+        std::size_t getEntryCount() const;
+        std::size_t getSizeBytes() const;
+
+        /**
+         * @brief Removes every entry (the counters are kept).
+         */
+        void clear();
+
+        /**
+         * @brief Writes every entry to a file, least recently used first.
+         * @throw std::runtime_error If the file cannot be written.
+         */
+        void save(const std::string& filename) const;
+
+        /**
+         * @brief Inserts the entries of a file written by save() (the budget still applies).
+         * @throw std::runtime_error If the file cannot be read or is not a cache file.
+         */
+        void load(const std::string& filename);
+
+        /**
+         * @brief Process-wide cache (64 MB), created on first access.
+         */
+        static PricingCache& shared();
+
+    private:
+
+        struct Entry {
+            std::string key;
+            PricingResult result;
+            std::size_t bytes;
+        };
+
+        struct Stripe {
+            std::mutex mutex;
+            std::list<Entry> lru;   // most recently used first
+            std::unordered_map<std::string, std::list<Entry>::iterator> index;
+            std::size_t bytes = 0;
+        };
+
+        Stripe& stripeFor(const PricingKey& key) { return *stripes[key.getHash() % stripes.size()]; }
+        void insertText(const std::string& text, std::uint64_t hash, const PricingResult& result);
+
+        std::vector<std::unique_ptr<Stripe>> stripes;
+        std::size_t stripe_budget;
+
+        std::atomic<std::uint64_t> hits;
+        std::atomic<std::uint64_t> misses;
+        std::atomic<std::uint64_t> evictions;
+};
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef PRICINGEXECUTOR_HPP
+#define PRICINGEXECUTOR_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Fixed-size thread pool on which pricing tasks are executed.
+ * * Tasks are run in submission order by the first available worker thread.
+ * A process-wide instance is available through shared(), so that every
+ * component submitting pricings shares the same cores instead of
+ * oversubscribing the machine.
+ */
+class PricingExecutor {
+
+    public:
+
+        /**
+         * @brief Starts the worker threads.
+         * @param num_threads Number of threads (0 = std::thread::hardware_concurrency()).
+         */
+        explicit PricingExecutor(unsigned num_threads = 0);
+
+        /**
+         * @brief Stops the pool once every queued task has run, then joins the workers.
+         * * Queued tasks are not discarded: their promises would never be fulfilled.
+         * Cancel the PricingJob objects first for a fast shutdown (a cancelled job
+         * finishes at its next progress report, or right away if it has not started).
+         */
+        ~PricingExecutor();
+
+        PricingExecutor(const PricingExecutor&) = delete;
+        PricingExecutor& operator=(const PricingExecutor&) = delete;
+
+        /**
+         * @brief Queues a task. Exceptions escaping the task are swallowed,
+         * so tasks must report their errors themselves (e.g. through a promise).
+         * @param task The work to run on a worker thread.
+         */
+        void submit(std::function<void()> task);
+
+        /**
+         * @brief Number of worker threads.
+         */
+        unsigned getThreadCount() const { return static_cast<unsigned>(workers.size()); }
+
+        /**
+         * @brief True if the calling thread is one of the workers of this pool. A task that
+         * would wait for other tasks of the same pool must not block in that case
+         * (it would hold a worker the queued work may need).
+         */
+        bool isWorkerThread() const;
+
+        /**
+         * @brief Process-wide executor, created on first access with one thread per core.
+         */
+        static PricingExecutor& shared();
+
+    private:
+
+        void workerLoop();
+
+        std::vector<std::thread> workers;
+        std::deque<std::function<void()>> tasks;
+        std::mutex mutex;
+        std::condition_variable available;
+        bool stopping = false;
+};
+
+#endif
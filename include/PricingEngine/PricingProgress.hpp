@@ -0,0 +1,50 @@
+#ifndef PRICINGPROGRESS_HPP
+#define PRICINGPROGRESS_HPP
+
+#include <functional>
+#include <stdexcept>
+
+/**
+ * @brief Snapshot of a running pricing, reported at batch (or time-step) boundaries.
+ */
+struct PricingProgress {
+
+    /**
+     * @brief Completed share of the work, between 0 and 1 (an upper-bound estimate for adaptive runs).
+     */
+    double fraction = 0.0;
+
+    /**
+     * @brief Number of paths simulated so far (0 for deterministic engines).
+     */
+    long long paths = 0;
+
+    /**
+     * @brief Interim price estimate.
+     */
+    double price = 0.0;
+
+    /**
+     * @brief Interim standard error (0 for deterministic engines).
+     */
+    double standard_error = 0.0;
+};
+
+/**
+ * @brief Observer called by the engines with interim results.
+ * * It runs on the thread executing the pricing. Returning false requests a
+ * cooperative cancellation: the engine stops at the next boundary.
+ */
+using ProgressCallback = std::function<bool(const PricingProgress&)>;
+
+/**
+ * @brief Thrown by engines that cannot return a meaningful partial result when cancelled.
+ */
+class PricingCancelled : public std::runtime_error {
+
+    public:
+
+        PricingCancelled() : std::runtime_error("Pricing cancelled.") {}
+};
+
+#endif
@@ -2,11 +2,21 @@
 #define PRICINGRESULT_HPP
 
 #include <vector>
-#include <cmath> 
+#include <cmath>
+#include <iosfwd>
+#include <string>
+
+#include "PayoffStatistics.hpp"
+#include "Utils/FixedHistogram.hpp"
+#include "Utils/Instrumentation.hpp"
+#include "Utils/QuantileSketch.hpp"
 
 /**
  * @brief Structure/Classe pour stocker et rapporter les résultats de la simulation Monte Carlo.
  * Elle contient le prix estimé, l'erreur statistique, et la distribution des payoffs.
+ * * When it is built from PayoffStatistics, the result also carries the sufficient
+ * statistics of the run, so that partial runs (checkpoints, shards) can be merged
+ * exactly and serialized without keeping the payoffs.
  */
 class PricingResult {
 
@@ -14,10 +24,46 @@ class PricingResult {
 
         double price;
         double standard_error;
-        
+
         // The distribution of realized payoffs is stored for variance calculation and graphing.
         std::vector<double> payoff_distribution;
 
+        /**
+         * @brief Streaming quantile sketch of the individual (undiscounted) payoffs.
+         * Filled by the Monte Carlo engines on request (MonteCarloPricer::setPayoffQuantiles,
+         * AdaptiveSettings::keep_quantiles), so quantiles, VaR and ES do not need
+         * payoff_distribution; empty otherwise.
+         */
+        QuantileSketch quantiles;
+
+        /**
+         * @brief Fixed-bin histogram of the payoffs (disabled unless the engine was given a layout).
+         */
+        FixedHistogram histogram;
+
+        /**
+         * @brief Sufficient statistics of the undiscounted independent samples
+         * (one sample per path, or per antithetic pair).
+         */
+        PayoffStatistics statistics;
+
+        /**
+         * @brief Discount factor e^(-rT) applied to the payoff statistics.
+         */
+        double discount_factor = 1.0;
+
+        /**
+         * @brief Number of simulated paths behind each observation of statistics:
+         * 1, or 2 when the observations are antithetic pair averages.
+         */
+        int paths_per_sample = 1;
+
+        /**
+         * @brief Phase times and counters of the run (all zero unless the library
+         * is built with PRICER_INSTRUMENTATION). Not serialized.
+         */
+        Instrumentation::Snapshot instrumentation;
+
         /**
          * @brief Constructor for initializing the results.
          * @param p The estimated option price.
@@ -26,30 +72,113 @@ class PricingResult {
          */
         PricingResult(double p, double se, const std::vector<double>& dist)
             : price(p), standard_error(se), payoff_distribution(dist) {}
-                
+
+        /**
+         * @brief Builds a mergeable result from payoff statistics.
+         * price = df * mean and standard_error = df * sqrt(variance / n).
+         * @param stats The statistics of the undiscounted samples.
+         * @param df The discount factor e^(-rT).
+         * @param dist Optional copy of the realized payoffs.
+         */
+        PricingResult(const PayoffStatistics& stats, double df, const std::vector<double>& dist = {});
+
+        /**
+         * @brief Number of simulated paths (observations times paths_per_sample).
+         */
+        std::uint64_t getPathCount() const {
+            return statistics.getCount() * static_cast<std::uint64_t>(paths_per_sample);
+        }
+
+        /**
+         * @brief Absorbs a result computed on a disjoint set of paths (same option, same model).
+         * * The statistics are merged exactly and the price and standard error are
+         * recomputed; the payoff distributions are concatenated, the sketches
+         * and histograms merged and the instrumentation totals added.
+         * @param other The partial result to merge.
+         * @throw std::invalid_argument If the discount factors differ, or if one result
+         *        holds antithetic pair averages and the other plain payoffs.
+         */
+        void merge(const PricingResult& other);
+
         /**
          * @brief Calculates the width of the 95% confidence interval.
          * The confidence interval is typically Price +/- 1.96 * Standard Error.
          * @return 1.96 * standard_error.
          */
-        double confidenceInterval95Width() const { 
+        double confidenceInterval95Width() const {
             // 1.96 is the approximate Z-score for 95% confidence
-            return 1.96 * standard_error; 
+            return 1.96 * standard_error;
         }
-        
+
         /**
          * @brief Returns the lower bound of the 95% confidence interval.
          */
         double confidenceInterval95Lower() const {
             return price - confidenceInterval95Width();
         }
-        
+
         /**
          * @brief Returns the upper bound of the 95% confidence interval.
          */
         double confidenceInterval95Upper() const {
             return price + confidenceInterval95Width();
         }
+
+        /**
+         * @brief Quantile of the undiscounted payoff (from the sketch).
+         * @param q A probability in [0, 1].
+         */
+        double getPayoffQuantile(double q) const { return quantiles.getQuantile(q); }
+
+        /**
+         * @brief Value at Risk at maturity of a position bought (or sold) at price.
+         * * Long: loss = price - df * payoff, VaR = price - df * Q(1 - confidence).
+         * Short: loss = df * payoff - price, VaR = df * Q(confidence) - price.
+         * @param confidence The confidence level, e.g. 0.99.
+         * @param short_position True for the seller of the option.
+         */
+        double getValueAtRisk(double confidence, bool short_position = false) const;
+
+        /**
+         * @brief Expected Shortfall (mean loss beyond the VaR), same conventions as getValueAtRisk().
+         */
+        double getExpectedShortfall(double confidence, bool short_position = false) const;
+
+        /**
+         * @brief Serializes the result (statistics, discount factor, paths per sample,
+         * optional distribution, quantile sketch and histogram).
+         * The format is little-endian and starts with a magic tag and a version number.
+         * @param os The destination stream (opened in binary mode).
+         * @param include_distribution If false, the payoff vector is not written.
+         */
+        void writeBinary(std::ostream& os, bool include_distribution = false) const;
+
+        /**
+         * @brief Reads a result written by writeBinary().
+         * @param is The source stream (opened in binary mode).
+         * @return The decoded result.
+         * @throw std::runtime_error If the stream is not a valid serialized result.
+         */
+        static PricingResult readBinary(std::istream& is);
+
+        /**
+         * @brief Writes the result to a checkpoint file (see writeBinary).
+         * @throw std::runtime_error If the file cannot be written.
+         */
+        void saveCheckpoint(const std::string& filename, bool include_distribution = false) const;
+
+        /**
+         * @brief Loads a checkpoint file written by saveCheckpoint().
+         * @throw std::runtime_error If the file cannot be read or is invalid.
+         */
+        static PricingResult loadCheckpoint(const std::string& filename);
+
+    private:
+
+        /**
+         * @brief Recomputes price and standard_error from statistics and discount_factor.
+         */
+        void refreshFromStatistics();
 };
 
-#endif 
\ No newline at end of file
+#endif
@@ -0,0 +1,169 @@
+#ifndef PRICINGSERVER_HPP
+#define PRICINGSERVER_HPP
+
+#include "PricingExecutor.hpp"
+#include "../Utils/LatencyHistogram.hpp"
+#include "../Utils/PricingProtocol.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Configuration of a PricingServer.
+ */
+struct ServerSettings {
+
+    /**
+     * @brief "unix:<path>" for a Unix domain socket, or "tcp:<port>" to listen on 127.0.0.1.
+     */
+    std::string address = "unix:/tmp/option_pricer.sock";
+
+    /**
+     * @brief Number of pricing threads (0 = one per core).
+     */
+    unsigned num_threads = 0;
+
+    /**
+     * @brief Time during which requests are accumulated before being dispatched, so that
+     * concurrent requests on the same model can share one simulation.
+     */
+    int coalesce_window_us = 200;
+};
+
+/**
+ * @brief Long-running pricing daemon speaking the PricingProtocol.
+ * * One I/O thread accepts connections and decodes the requests, a dispatcher
+ * groups them and a warm PricingExecutor prices them. Monte Carlo requests
+ * (engine "mc" without a precision target) that share the model, the maturity,
+ * the seed and the path count are coalesced into a single portfolio run
+ * (MonteCarloPricer::calculatePortfolioPrices): the paths are simulated once and
+ * every option of the group is evaluated on them. The other requests are priced
+ * individually with TradePricer. Client sockets are non-blocking: the pricing
+ * threads queue their responses on the connection and the I/O thread sends them
+ * when the socket is writable, so a client that stops reading stalls nobody (it
+ * is disconnected once 64 MB of responses are pending). Requests failing
+ * TradeSpec::validate() are answered with an error without being priced.
+ * Latencies (reception to response) are recorded in lock-free histograms. While every pricing thread is busy the dispatcher
+ * holds the new requests, so the groups grow with the load.
+ * * Available on POSIX systems only.
+ */
+class PricingServer {
+
+    public:
+
+        explicit PricingServer(const ServerSettings& settings_in);
+
+        /**
+         * @brief Stops the server if it is running.
+         */
+        ~PricingServer();
+
+        PricingServer(const PricingServer&) = delete;
+        PricingServer& operator=(const PricingServer&) = delete;
+
+        /**
+         * @brief Binds the socket and starts the I/O and dispatch threads.
+         * @throw std::runtime_error If the address cannot be bound or the platform is not POSIX.
+         */
+        void start();
+
+        /**
+         * @brief Closes the socket and every connection, then joins the threads.
+         */
+        void stop();
+
+        /**
+         * @brief Text report: request counters, coalescing ratio and latency percentiles.
+         */
+        std::string getStatistics() const;
+
+        const LatencyHistogram& getLatencyHistogram() const { return latency; }
+
+    private:
+
+        struct Connection;
+
+        struct PendingRequest {
+            std::shared_ptr<Connection> connection;
+            std::uint64_t request_id = 0;
+            TradeSpec trade;
+            std::chrono::steady_clock::time_point received;
+        };
+
+        void ioLoop();
+        void dispatchLoop();
+        void dispatch(std::vector<PendingRequest>& requests);
+        void submitGroup(const std::shared_ptr<std::vector<PendingRequest>>& group);
+        void priceGroup(std::vector<PendingRequest>& group);
+        void respond(const PendingRequest& request, const TradeResult& result);
+        void queueOutput(Connection& connection, const std::string& frame);
+
+        ServerSettings settings;
+        std::string unix_path;             // removed by stop() for Unix sockets
+        int listen_fd = -1;
+        int wake_fds[2] = {-1, -1};        // self-pipe used to interrupt poll()
+
+        LatencyHistogram latency;          // reception -> response queued for sending
+        LatencyHistogram queue_latency;    // reception -> start of the pricing
+        std::atomic<std::uint64_t> num_requests;
+        std::atomic<std::uint64_t> num_errors;
+        std::atomic<std::uint64_t> num_runs;
+
+        std::mutex queue_mutex;
+        std::condition_variable queue_ready;
+        std::vector<PendingRequest> queue;
+        unsigned runs_in_flight = 0;       // groups submitted and not yet priced
+        bool running = false;
+
+        std::thread io_thread;
+        std::thread dispatch_thread;
+
+        // Declared last: destroyed (and joined) first, while the members used by the tasks still exist
+        PricingExecutor executor;
+};
+
+/**
+ * @brief Blocking client of a PricingServer (one connection, one request at a time).
+ */
+class PricingClient {
+
+    public:
+
+        /**
+         * @param address Same syntax as ServerSettings::address.
+         * @throw std::runtime_error If the connection fails.
+         */
+        explicit PricingClient(const std::string& address);
+
+        ~PricingClient();
+
+        PricingClient(const PricingClient&) = delete;
+        PricingClient& operator=(const PricingClient&) = delete;
+
+        /**
+         * @brief Sends a trade and waits for its price.
+         * @throw std::runtime_error If the connection is lost.
+         */
+        TradeResult price(const TradeSpec& trade);
+
+        /**
+         * @brief Asks for the server report (see PricingServer::getStatistics).
+         */
+        std::string getServerStatistics();
+
+    private:
+
+        PricingProtocol::Message roundTrip(PricingProtocol::Message request);
+
+        int fd = -1;
+        std::uint64_t next_id = 1;
+        std::string buffer;
+};
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef RAREEVENTPRICER_HPP
+#define RAREEVENTPRICER_HPP
+
+#include "../Core/Option.hpp"
+#include "../Models/GBM.hpp"
+#include "PricingResult.hpp"
+#include <limits>
+
+/**
+ * @brief Sampling settings of a RareEventPricer run.
+ */
+struct RareEventSettings {
+
+    /**
+     * @brief Number of equiprobable strata of the terminal normal (1 = no stratification).
+     */
+    int strata = 64;
+
+    /**
+     * @brief Recentres the terminal normal on the exercise region (drift shift).
+     */
+    bool importance_sampling = true;
+
+    /**
+     * @brief Shift of the terminal normal; NaN selects RareEventPricer::findOptimalShift().
+     */
+    double shift = std::numeric_limits<double>::quiet_NaN();
+};
+
+/**
+ * @brief PricingResult enriched with the diagnostics of a stratified / importance-sampled run.
+ * * standard_error is the stratified error sqrt(sum_k p_k^2 V_k / n_k) of the weighted payoffs.
+ * The statistics member stays empty: the result cannot be merged with plain Monte Carlo runs.
+ */
+class RareEventResult : public PricingResult {
+
+    public:
+
+        /**
+         * @brief Shift of the terminal normal actually used (0 without importance sampling).
+         */
+        double shift;
+
+        /**
+         * @brief Number of strata of the run.
+         */
+        int strata;
+
+        /**
+         * @brief Fraction of the simulated paths with a non-zero payoff.
+         */
+        double hit_ratio;
+
+        RareEventResult(double p, double se)
+            : PricingResult(p, se, {}), shift(0.0), strata(1), hit_ratio(0.0) {}
+};
+
+/**
+ * @brief Monte Carlo engine for deep out-of-the-money options under GBM.
+ * * Each path is built from its standardized terminal value xi = W_T / sqrt(T):
+ * xi is drawn first, then the intermediate points follow by Brownian bridge, so
+ * the law of every path is the GBM law and any Option (Call, Put, CallSpread,
+ * Asian...) can be priced. Two variance reductions act on xi:
+ *  - stratification: path i falls in stratum k = i mod K and takes
+ *    xi = Phi^-1((k + U) / K), so every region of the terminal distribution,
+ *    tails included, receives its share of paths;
+ *  - importance sampling: xi is shifted by theta (a constant drift shift of the
+ *    Brownian motion) and the payoff is weighted by the likelihood ratio
+ *    exp(-theta * xi + theta^2 / 2).
+ * With a far strike nearly every plain path pays zero; the shifted paths land in
+ * the exercise region and the weights bring the estimator back to the right mean.
+ * With a one-step GBM only the terminal value is simulated.
+ */
+class RareEventPricer {
+
+    public:
+
+        /**
+         * @brief Constructs the pricer.
+         * @param option_in The option to be priced.
+         * @param model_in The GBM model (S0, mu, sigma and number of steps).
+         */
+        RareEventPricer(const Option& option_in, const GBM& model_in);
+
+        /**
+         * @brief Shift theta maximizing log payoff(path(theta)) - theta^2 / 2.
+         * * path(xi) is the mean path given the terminal value (no bridge noise). The
+         * maximizer is the mode of the zero-variance importance density along that
+         * path: a grid search over [-8, 8] followed by a golden-section refinement.
+         * @return The optimal shift, or 0 if the payoff vanishes on the whole grid.
+         */
+        double findOptimalShift() const;
+
+        /**
+         * @brief Runs the stratified and/or importance-sampled simulation.
+         * @param num_simulations Number of paths (at least 2 per stratum).
+         * @param settings Strata, importance sampling and shift.
+         * @return The discounted price, its stratified standard error and the diagnostics.
+         * @throw std::invalid_argument If strata < 1 or num_simulations < 2 * strata.
+         */
+        RareEventResult calculatePrice(int num_simulations,
+                                       const RareEventSettings& settings = RareEventSettings()) const;
+
+    private:
+
+        const Option& option;
+        const GBM& model;
+
+        /**
+         * @brief Writes into out the mean GBM path given the standardized terminal value xi.
+         */
+        void meanPath(double xi, Path& out) const;
+};
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef REPRICINGSESSION_HPP
+#define REPRICINGSESSION_HPP
+
+#include "../Core/Option.hpp"
+#include "../Models/GBM.hpp"
+#include "PricingResult.hpp"
+#include "GreeksPricer.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Monte Carlo session that re-prices one option on market ticks without re-simulating.
+ * * GBM paths are multiplicatively linear in S0: S_t = S0 * X_t where X_t does not
+ * depend on S0. The session simulates the normalized paths X once (fixed seed)
+ * and keeps them; a new spot only rescales each path before the payoff, so a
+ * tick costs the payoff evaluations and nothing else.
+ * * Small volatility moves are handled by likelihood-ratio reweighting: each cached
+ * path keeps the sum and the sum of squares of its log-increments, which are
+ * sufficient to compute the ratio of its densities under the new and the
+ * original sigma. The weights degrade as sigma moves away from the simulated
+ * value; getEffectiveSampleSize() tells how many paths are still effectively used.
+ * * All prices of a session share the same paths (common random numbers), so bumped
+ * Greeks are free of simulation noise between the bumps.
+ */
+class RepricingSession {
+
+    public:
+
+        /**
+         * @brief Simulates and caches the normalized paths.
+         * * Re-seeds the RNG of the calling thread with seed.
+         * @param option_in The option to re-price (kept by reference).
+         * @param model_in The GBM model (steps, mu and the reference sigma; S0 is ignored).
+         * @param num_paths Number of cached paths.
+         * @param seed Seed of the cached paths.
+         * @throw std::invalid_argument If num_paths is not positive.
+         */
+        RepricingSession(const Option& option_in, const GBM& model_in, int num_paths, std::uint64_t seed = 42);
+
+        /**
+         * @brief Price for a new spot, at the reference volatility.
+         */
+        PricingResult price(double S0) const;
+
+        /**
+         * @brief Price for a new spot and a new volatility (likelihood-ratio reweighting).
+         */
+        PricingResult price(double S0, double sigma_new) const;
+
+        /**
+         * @brief Delta and Gamma by central differences on the common cached paths.
+         * @param S0 The spot.
+         * @param epsilon The spot bump.
+         */
+        GreeksResult calculateDeltaGamma(double S0, double epsilon) const;
+
+        /**
+         * @brief Effective sample size (sum w)^2 / sum w^2 of the likelihood-ratio weights for sigma_new.
+         */
+        double getEffectiveSampleSize(double sigma_new) const;
+
+        int getNumPaths() const { return num_paths; }
+        double getReferenceSigma() const { return sigma; }
+
+    private:
+
+        /**
+         * @brief Likelihood ratio of cached path p for sigma_new.
+         */
+        double weight(std::size_t p, double sigma_new) const;
+
+        /**
+         * @brief Payoff statistics of the rescaled paths, optionally weighted.
+         */
+        PricingResult evaluate(double S0, const double* sigma_new) const;
+
+        const Option& option;
+        int num_paths;
+        int steps;
+        double mu;
+        double sigma;
+        double dt;
+
+        std::vector<double> normalized;    // num_paths rows of steps + 1 values, X_0 = 1
+        std::vector<double> sum_log;       // sum of the log-increments of each path
+        std::vector<double> sum_log_sq;    // sum of their squares
+};
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef SCENARIOPRICER_HPP
+#define SCENARIOPRICER_HPP
+
+#include "../Core/Option.hpp"
+#include "../Core/ScenarioFile.hpp"
+#include "PricingResult.hpp"
+
+/**
+ * @brief Monte Carlo pricing on a stored scenario set instead of fresh simulations.
+ * * The paths are read from the (memory-mapped) ScenarioFile block by block, like
+ * MonteCarloPricer: each block is transposed into the thread PathArena and the payoffs
+ * are evaluated on Path views, so several pricers (or processes) can price different
+ * books on the same scenarios without regenerating them.
+ */
+class ScenarioPricer {
+
+    public:
+
+        /**
+         * @brief Constructs the pricer.
+         * @param option_in The option to price.
+         * @param scenarios_in The scenario set (must outlive the pricer).
+         */
+        ScenarioPricer(const Option& option_in, const ScenarioFile& scenarios_in);
+
+        /**
+         * @brief Prices the option on the stored paths.
+         * @param max_paths Number of paths to use (0 = every stored path).
+         * @return A PricingResult (the distribution vector is left empty).
+         * @throw std::invalid_argument If the option maturity differs from the scenario horizon.
+         */
+        PricingResult calculatePrice(std::uint64_t max_paths = 0) const;
+
+    private:
+
+        const Option& option;
+        const ScenarioFile& scenarios;
+};
+
+#endif
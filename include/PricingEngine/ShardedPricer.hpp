@@ -0,0 +1,97 @@
+#ifndef SHARDEDPRICER_HPP
+#define SHARDEDPRICER_HPP
+
+#include "../Core/Option.hpp"
+#include "../Models/AssetModel.hpp"
+#include "../Models/RNG.hpp"
+#include "PricingResult.hpp"
+#include <cstdint>
+
+/**
+ * @brief Execution settings of a sharded (multi-process) Monte Carlo run.
+ */
+struct ShardSettings {
+
+    /**
+     * @brief Number of worker processes (0 = one per online CPU).
+     */
+    int num_workers = 0;
+
+    /**
+     * @brief Number of paths per batch. Each batch is simulated with its own RNG stream.
+     */
+    int batch_size = 100000;
+
+    /**
+     * @brief Base seed of the run. Batch j always uses RNG stream (seed, j).
+     */
+    std::uint64_t seed = 42;
+
+    /**
+     * @brief If true (Linux only), worker i is pinned to the i-th CPU (modulo) of the
+     * process affinity mask, which spreads the workers over the allowed CPUs instead
+     * of letting them migrate.
+     */
+    bool pin_workers = false;
+
+    /**
+     * @brief Variance reduction of the normal draws, applied inside each batch
+     * (antithetic pairs and moment matching never span two batches).
+     */
+    SamplingScheme sampling;
+
+    /**
+     * @brief If true, each batch fills the quantile sketch merged into the result.
+     */
+    bool keep_quantiles = false;
+};
+
+/**
+ * @brief Monte Carlo pricer that splits a run across forked worker processes.
+ * * The coordinator cuts the run into batches of batch_size paths and gives each
+ * worker a contiguous range of batch indices, i.e. a disjoint range of RNG streams.
+ * The workers inherit the option and the model through fork(), simulate their
+ * batches and stream one serialized PricingResult (sufficient statistics only)
+ * per batch back through a pipe. The coordinator merges the summaries as they
+ * arrive. Since the streams are tied to the batch index, the final result only
+ * depends on (seed, num_simulations, batch_size), not on the number of workers.
+ * * Available on POSIX systems only. The workers are forked from the caller, so the
+ * caller must be single-threaded: a thread of the parent (PricingExecutor, AsyncPricer,
+ * PricingServer...) may hold a lock of the allocator or of the streams at fork time,
+ * which would deadlock the child. Run the sharded pricer before starting any thread.
+ */
+class ShardedPricer {
+
+    public:
+
+        /**
+         * @brief Constructs the sharded pricer.
+         * @param option_in The option to be priced.
+         * @param model_in The simulation model (any AssetModel).
+         */
+        ShardedPricer(const Option& option_in, const AssetModel& model_in);
+
+        /**
+         * @brief Runs num_simulations paths over several worker processes.
+         * @param num_simulations Total number of paths.
+         * @param settings Worker count, batch size, seed and pinning.
+         * @return The merged PricingResult (statistics and quantile sketch, no payoff vector).
+         * @throw std::invalid_argument If num_simulations or batch_size is not positive.
+         * @throw std::runtime_error If the process already runs several threads (Linux),
+         *        if a worker cannot be started, fails, or if the platform does not
+         *        support fork().
+         */
+        PricingResult calculatePrice(long long num_simulations, const ShardSettings& settings) const;
+
+    private:
+
+        const Option& option;
+        const AssetModel& model;
+
+        /**
+         * @brief Simulates one batch in the current process with RNG stream (seed, batch_index).
+         */
+        PricingResult simulateBatch(int num_paths, const ShardSettings& settings, std::uint64_t batch_index) const;
+};
+
+#endif
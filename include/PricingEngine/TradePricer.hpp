@@ -0,0 +1,42 @@
+#ifndef TRADEPRICER_HPP
+#define TRADEPRICER_HPP
+
+#include "../Core/Option.hpp"
+#include "../Models/AssetModel.hpp"
+#include "../Utils/TradeFile.hpp"
+#include <memory>
+
+/**
+ * @brief Builds the option, the model and the engine described by a TradeSpec and prices it.
+ * * Engines: "mc" (adaptive Monte Carlo, stopped at target_error or max_paths, RNG
+ * seeded with the trade seed so a result only depends on the trade line), "mc-is"
+ * (RareEventPricer over max_paths paths, GBM only, parameters strata and shift),
+ * "analytic" (Black-Scholes / Merton closed forms), "fourier" (COS), "edp"
+ * (finite differences, GBM only) and "lattice" (Leisen-Reimer tree, GBM only,
+ * parameters tree_steps and american). The mc, analytic and edp results go
+ * through PricingCache::shared(), so repeated identical trades are not recomputed.
+ */
+class TradePricer {
+
+    public:
+
+        /**
+         * @throw std::invalid_argument If the type is unknown or the strike count does not match.
+         */
+        static std::unique_ptr<Option> createOption(const TradeSpec& trade);
+
+        /**
+         * @throw std::invalid_argument If the model is unknown.
+         */
+        static std::unique_ptr<AssetModel> createModel(const TradeSpec& trade);
+
+        /**
+         * @brief Prices one trade and measures its wall-clock time.
+         * Errors are reported in TradeResult::error instead of being thrown,
+         * so that one bad trade does not stop a batch; a trade read in error
+         * (TradeSpec::error) is reported as is.
+         */
+        static TradeResult price(const TradeSpec& trade);
+};
+
+#endif
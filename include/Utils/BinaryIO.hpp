@@ -0,0 +1,77 @@
+#ifndef BINARYIO_HPP
+#define BINARYIO_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+
+/**
+ * @brief Helpers to read and write fixed-size values in little-endian order.
+ * * Used by every binary format of the project (pricing checkpoints, shards...)
+ * so that files and messages can be exchanged between machines.
+ */
+namespace BinaryIO {
+
+    inline void writeU64(std::ostream& os, std::uint64_t value) {
+        unsigned char bytes[8];
+        for (int i = 0; i < 8; ++i) {
+            bytes[i] = static_cast<unsigned char>(value >> (8 * i));
+        }
+        os.write(reinterpret_cast<const char*>(bytes), 8);
+    }
+
+    inline void writeU32(std::ostream& os, std::uint32_t value) {
+        unsigned char bytes[4];
+        for (int i = 0; i < 4; ++i) {
+            bytes[i] = static_cast<unsigned char>(value >> (8 * i));
+        }
+        os.write(reinterpret_cast<const char*>(bytes), 4);
+    }
+
+    inline void writeDouble(std::ostream& os, double value) {
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        writeU64(os, bits);
+    }
+
+    /**
+     * @throw std::runtime_error If the stream ends before 8 bytes are read.
+     */
+    inline std::uint64_t readU64(std::istream& is) {
+        unsigned char bytes[8];
+        if (!is.read(reinterpret_cast<char*>(bytes), 8)) {
+            throw std::runtime_error("Error: truncated binary stream.");
+        }
+        std::uint64_t value = 0;
+        for (int i = 0; i < 8; ++i) {
+            value |= static_cast<std::uint64_t>(bytes[i]) << (8 * i);
+        }
+        return value;
+    }
+
+    /**
+     * @throw std::runtime_error If the stream ends before 4 bytes are read.
+     */
+    inline std::uint32_t readU32(std::istream& is) {
+        unsigned char bytes[4];
+        if (!is.read(reinterpret_cast<char*>(bytes), 4)) {
+            throw std::runtime_error("Error: truncated binary stream.");
+        }
+        std::uint32_t value = 0;
+        for (int i = 0; i < 4; ++i) {
+            value |= static_cast<std::uint32_t>(bytes[i]) << (8 * i);
+        }
+        return value;
+    }
+
+    inline double readDouble(std::istream& is) {
+        std::uint64_t bits = readU64(is);
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+}
+
+#endif
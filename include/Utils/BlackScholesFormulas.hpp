@@ -24,6 +24,14 @@ namespace BlackScholesFormulas {
      */
     double N_cdf(double x);
 
+    /**
+     * @brief Inverse of the Standard Normal CDF (quantile function: Phi^-1(p)).
+     * Acklam's rational approximation refined by one Halley step (relative error ~1e-15).
+     * @param p A probability in the open interval (0, 1).
+     * @return The z-value such that Phi(z) = p (-inf/+inf at p = 0/1).
+     */
+    double N_inv(double p);
+
 
     /**
      * @brief Calculates the Black-Scholes d1 and d2 parameters.
@@ -39,6 +47,32 @@ namespace BlackScholesFormulas {
     void calculate_d1_d2(double S, double K, double T, double r, double sigma, 
                          double& d1, double& d2);
 
+    // --- Analytic Prices for European Options (BS Model) ---
+
+    /**
+     * @brief Black-Scholes price of a European Call.
+     * Call = S * Phi(d1) - K * exp(-r*T) * Phi(d2).
+     * @param S Current price of the underlying asset.
+     * @param K Strike price of the option.
+     * @param T Time remaining until maturity (in years).
+     * @param r Risk-free rate.
+     * @param sigma Volatility of the asset.
+     * @return The Call price.
+     */
+    double callPrice(double S, double K, double T, double r, double sigma);
+
+    /**
+     * @brief Black-Scholes price of a European Put.
+     * Put = K * exp(-r*T) * Phi(-d2) - S * Phi(-d1).
+     * @param S Current price of the underlying asset.
+     * @param K Strike price of the option.
+     * @param T Time remaining until maturity (in years).
+     * @param r Risk-free rate.
+     * @param sigma Volatility of the asset.
+     * @return The Put price.
+     */
+    double putPrice(double S, double K, double T, double r, double sigma);
+
     // --- Analytic Greeks for European Options (BS Model) ---
 
     /**
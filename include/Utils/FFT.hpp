@@ -0,0 +1,21 @@
+#ifndef FFT_HPP
+#define FFT_HPP
+
+#include <complex>
+#include <vector>
+
+/**
+ * @brief Minimal radix-2 Fast Fourier Transform (no external dependency).
+ */
+namespace FFT {
+
+    /**
+     * @brief In-place forward transform X_u = sum_j x_j * exp(-2*pi*i*j*u/N).
+     * Iterative Cooley-Tukey: bit-reversal permutation then log2(N) butterfly passes.
+     * @param data The sequence to transform; its size must be a power of two.
+     * @throw std::invalid_argument If the size is not a power of two.
+     */
+    void forward(std::vector<std::complex<double>>& data);
+}
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef FIXEDHISTOGRAM_HPP
+#define FIXEDHISTOGRAM_HPP
+
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+/**
+ * @brief Histogram with equal-width bins on a fixed range [lower, upper).
+ * * Values outside the range are counted in underflow / overflow, NaN values
+ * apart (getNaNCount(), not included in getCount()). Histograms
+ * with the same layout are merged by adding the counts, so partial runs
+ * (threads, shards) combine exactly. A default-constructed histogram is
+ * disabled: add() does nothing and merge() adopts the layout of the other one.
+ */
+class FixedHistogram {
+
+    public:
+
+        /**
+         * @brief Creates a disabled histogram (no bins).
+         */
+        FixedHistogram() = default;
+
+        /**
+         * @brief Creates an empty histogram.
+         * @param lower_in Lower edge of the first bin.
+         * @param upper_in Upper edge of the last bin.
+         * @param bins Number of bins.
+         * @throw std::invalid_argument If upper_in <= lower_in or bins <= 0.
+         */
+        FixedHistogram(double lower_in, double upper_in, int bins);
+
+        bool isEnabled() const { return !counts.empty(); }
+
+        /**
+         * @brief Adds one observation (no-op if disabled).
+         */
+        void add(double x);
+
+        /**
+         * @brief Adds n observations.
+         */
+        void add(const double* values, std::size_t n);
+
+        /**
+         * @brief Adds the counts of a histogram with the same layout.
+         * @throw std::invalid_argument If both are enabled with different layouts.
+         */
+        void merge(const FixedHistogram& other);
+
+        double getLower() const { return lower; }
+        double getUpper() const { return upper; }
+        int getBins() const { return static_cast<int>(counts.size()); }
+        double getBinWidth() const { return counts.empty() ? 0.0 : (upper - lower) / counts.size(); }
+        double getBinLower(int bin) const { return lower + bin * getBinWidth(); }
+        std::uint64_t getBinCount(int bin) const { return counts[static_cast<std::size_t>(bin)]; }
+        std::uint64_t getUnderflow() const { return underflow; }
+        std::uint64_t getOverflow() const { return overflow; }
+        std::uint64_t getNaNCount() const { return nan_count; }
+
+        /**
+         * @brief Total number of observations, including underflow and overflow.
+         */
+        std::uint64_t getCount() const { return total; }
+
+        /**
+         * @brief Approximate quantile, linear inside the bin that contains it.
+         * Quantiles in the underflow (overflow) part are clamped to lower (upper).
+         * @param q A probability in [0, 1].
+         */
+        double getQuantile(double q) const;
+
+        void writeBinary(std::ostream& os) const;
+
+        /**
+         * @brief Reads a histogram written by writeBinary().
+         * @param is The source stream.
+         * @param with_nan_count False for the older layout without the NaN count.
+         * @throw std::runtime_error If the stream is truncated or invalid.
+         */
+        static FixedHistogram readBinary(std::istream& is, bool with_nan_count = true);
+
+    private:
+
+        double lower = 0.0;
+        double upper = 0.0;
+        double inverse_width = 0.0;
+        std::vector<std::uint64_t> counts;
+        std::uint64_t underflow = 0;
+        std::uint64_t overflow = 0;
+        std::uint64_t nan_count = 0;
+        std::uint64_t total = 0;
+};
+
+#endif
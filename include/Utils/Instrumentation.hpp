@@ -0,0 +1,175 @@
+#ifndef INSTRUMENTATION_HPP
+#define INSTRUMENTATION_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#ifdef PRICER_INSTRUMENTATION
+    #if defined(__x86_64__) || defined(__i386__)
+        #include <x86intrin.h>
+    #else
+        #include <chrono>
+    #endif
+#endif
+
+/**
+ * @brief Hot-path instrumentation of the engines: phase timers and counters.
+ * * Enabled by the CMake option PRICER_INSTRUMENTATION (macro of the same name).
+ * When it is off, PRICER_TIME_SCOPE and PRICER_COUNT expand to nothing and the
+ * snapshots are all zero, so the engines pay nothing.
+ * * Each thread writes to its own record (single writer, relaxed atomics, no lock);
+ * readers sum the records. Phase times are exclusive: a scope opened inside
+ * another one (e.g. RNG draws inside path construction) stops the outer clock,
+ * so the phases of a run add up to the instrumented time. Timers read the CPU
+ * time-stamp counter on x86 and the steady clock elsewhere.
+ */
+namespace Instrumentation {
+
+    enum Phase : int {
+        RandomNumbers,
+        PathConstruction,
+        Payoff,
+        Statistics,
+        PHASE_COUNT
+    };
+
+    enum Counter : int {
+        Paths,
+        Draws,
+        Allocations,   // growth of the engine buffers (PathBatch, workspace, Path)
+        COUNTER_COUNT
+    };
+
+    const char* phaseName(Phase phase);
+    const char* counterName(Counter counter);
+
+    /**
+     * @brief Totals of the phase times (seconds) and of the counters.
+     */
+    struct Snapshot {
+        std::array<double, PHASE_COUNT> seconds{};
+        std::array<std::uint64_t, COUNTER_COUNT> counts{};
+
+        Snapshot& operator+=(const Snapshot& other);
+        Snapshot operator-(const Snapshot& other) const;
+        double totalSeconds() const;
+    };
+
+    /**
+     * @brief True if the library was compiled with PRICER_INSTRUMENTATION.
+     */
+    constexpr bool isEnabled() {
+#ifdef PRICER_INSTRUMENTATION
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Totals of the calling thread (use differences to measure one run).
+     */
+    Snapshot threadSnapshot();
+
+    /**
+     * @brief Totals of every thread, including the threads that have exited.
+     */
+    Snapshot globalSnapshot();
+
+    /**
+     * @brief Prometheus text exposition format (counters named <prefix>_...).
+     */
+    std::string toPrometheus(const Snapshot& snapshot, const std::string& prefix = "pricer");
+
+    /**
+     * @brief One JSON object {"seconds": {...}, "counts": {...}}.
+     */
+    std::string toJSON(const Snapshot& snapshot);
+
+#ifdef PRICER_INSTRUMENTATION
+
+    struct ThreadRecord {
+        std::array<std::atomic<std::uint64_t>, PHASE_COUNT> ticks{};
+        std::array<std::atomic<std::uint64_t>, COUNTER_COUNT> counts{};
+        int current_phase = -1;         // innermost open scope (-1 = none)
+        std::uint64_t phase_start = 0;  // tick at which current_phase was last resumed
+    };
+
+    /**
+     * @brief Record of the calling thread (registered on first use).
+     */
+    ThreadRecord& registerThread();
+
+    inline ThreadRecord& threadRecord() {
+        static thread_local ThreadRecord* record = &registerThread();
+        return *record;
+    }
+
+    inline std::uint64_t readTicks() {
+    #if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+    #else
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    #endif
+    }
+
+    // Single writer: a relaxed load + store is enough (no read-modify-write)
+    inline void addRelaxed(std::atomic<std::uint64_t>& slot, std::uint64_t value) {
+        slot.store(slot.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    inline void count(Counter counter, std::uint64_t n) {
+        addRelaxed(threadRecord().counts[counter], n);
+    }
+
+    /**
+     * @brief Charges the time spent until its destruction to a phase (exclusive of nested scopes).
+     */
+    class ScopedTimer {
+
+        public:
+
+            explicit ScopedTimer(Phase phase) : record(threadRecord()) {
+                std::uint64_t now = readTicks();
+                previous = record.current_phase;
+                if (previous >= 0) addRelaxed(record.ticks[previous], now - record.phase_start);
+                record.current_phase = phase;
+                record.phase_start = now;
+            }
+
+            ~ScopedTimer() {
+                std::uint64_t now = readTicks();
+                addRelaxed(record.ticks[record.current_phase], now - record.phase_start);
+                record.current_phase = previous;
+                record.phase_start = now;
+            }
+
+            ScopedTimer(const ScopedTimer&) = delete;
+            ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+        private:
+
+            ThreadRecord& record;
+            int previous;
+    };
+
+#endif
+}
+
+#define PRICER_CONCAT_IMPL(a, b) a##b
+#define PRICER_CONCAT(a, b) PRICER_CONCAT_IMPL(a, b)
+
+#ifdef PRICER_INSTRUMENTATION
+    #define PRICER_TIME_SCOPE(phase) \
+        Instrumentation::ScopedTimer PRICER_CONCAT(pricer_scope_, __LINE__)(Instrumentation::phase)
+    #define PRICER_COUNT(counter, n) \
+        Instrumentation::count(Instrumentation::counter, static_cast<std::uint64_t>(n))
+#else
+    #define PRICER_TIME_SCOPE(phase) ((void)0)
+    #define PRICER_COUNT(counter, n) ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef LATENCYHISTOGRAM_HPP
+#define LATENCYHISTOGRAM_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Lock-free log-linear histogram of latencies (in nanoseconds).
+ * * Values are grouped by power of two, each power being split into 16 linear
+ * sub-buckets, so the relative resolution is 1/16 (6%) from 16 ns up to about
+ * 18 minutes. record() is a single relaxed atomic increment, so the histogram
+ * can be shared by every thread of a server.
+ */
+class LatencyHistogram {
+
+    public:
+
+        LatencyHistogram();
+
+        /**
+         * @brief Adds one observation.
+         * @param nanoseconds The measured latency.
+         */
+        void record(std::uint64_t nanoseconds);
+
+        /**
+         * @brief Adds the counts of another histogram.
+         */
+        void merge(const LatencyHistogram& other);
+
+        std::uint64_t getCount() const;
+        double getMean() const;
+        std::uint64_t getMax() const { return max_value.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Approximate quantile (upper edge of the bucket that contains it).
+         * @param q A probability in [0, 1].
+         * @return The latency in nanoseconds (0 if the histogram is empty).
+         */
+        std::uint64_t getQuantile(double q) const;
+
+        /**
+         * @brief One-line summary "count mean p50 p90 p99 p99.9 max" in microseconds.
+         */
+        std::string summary() const;
+
+    private:
+
+        static const int SUB_BUCKETS = 16;
+        static const int NUM_BUCKETS = 40 * SUB_BUCKETS;
+
+        static int bucketIndex(std::uint64_t value);
+        static std::uint64_t bucketUpperEdge(int index);
+
+        std::array<std::atomic<std::uint64_t>, NUM_BUCKETS> counts;
+        std::atomic<std::uint64_t> total_count;
+        std::atomic<std::uint64_t> total_sum;
+        std::atomic<std::uint64_t> max_value;
+};
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef MERTONFORMULAS_HPP
+#define MERTONFORMULAS_HPP
+
+class Option;
+class Merton;
+
+/**
+ * @brief Namespace containing the closed-form Merton (1976) jump-diffusion prices.
+ * * The price is a Poisson-weighted series of Black-Scholes prices:
+ * V = sum_n exp(-lambda'T) (lambda'T)^n / n! * BS(S, K, T, r_n, sigma_n), with
+ * lambda' = lambda(1+k), sigma_n^2 = sigma^2 + n*jump_vol^2/T and
+ * r_n = r - lambda*k + n*log(1+k)/T.
+ * Used to validate the Monte Carlo engine and as a fast path for vanillas.
+ */
+namespace MertonFormulas {
+
+    /**
+     * @brief Merton price of a European Call.
+     * @param S Current price of the underlying asset.
+     * @param K Strike price of the option.
+     * @param T Time remaining until maturity (in years).
+     * @param r Risk-free rate.
+     * @param sigma Diffusion volatility.
+     * @param lambda Jump intensity.
+     * @param jump_mean Mean of the log jump size.
+     * @param jump_vol Standard deviation of the log jump size.
+     * @return The Call price.
+     */
+    double callPrice(double S, double K, double T, double r, double sigma,
+                     double lambda, double jump_mean, double jump_vol);
+
+    /**
+     * @brief Merton price of a European Put (same parameters as callPrice).
+     * @return The Put price.
+     */
+    double putPrice(double S, double K, double T, double r, double sigma,
+                    double lambda, double jump_mean, double jump_vol);
+
+    /**
+     * @brief Closed-form price of a vanilla option under a Merton model (fast path).
+     * @param option A EuropeanCall or EuropeanPut.
+     * @param model The Merton model (its drift is ignored, the option rate is used).
+     * @return The option price.
+     * @throw std::invalid_argument If the option has no closed form here.
+     */
+    double price(const Option& option, const Merton& model);
+}
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef PRICINGPROTOCOL_HPP
+#define PRICINGPROTOCOL_HPP
+
+#include "TradeFile.hpp"
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Binary messages exchanged with the pricing server (see PricingServer).
+ * * Frame = u32 payload length, then payload = u32 message type, u64 request id
+ * and a body. Every value is little-endian (BinaryIO), strings are a u32 length
+ * followed by the bytes. Responses carry the id of their request, so a client
+ * may pipeline several requests on one connection and match the answers.
+ */
+namespace PricingProtocol {
+
+    enum class MessageType : std::uint32_t {
+        PriceRequest = 1,    // body: TradeSpec
+        PriceResponse = 2,   // body: TradeResult
+        StatsRequest = 3,    // empty body
+        StatsResponse = 4    // body: text report
+    };
+
+    /**
+     * @brief A decoded message (only the fields of its type are meaningful).
+     */
+    struct Message {
+        MessageType type = MessageType::PriceRequest;
+        std::uint64_t request_id = 0;
+        TradeSpec trade;
+        TradeResult result;
+        std::string text;
+    };
+
+    /**
+     * @brief Encodes a complete frame (length prefix included).
+     */
+    std::string encode(const Message& message);
+
+    /**
+     * @brief Decodes the first complete frame of buffer, starting at offset.
+     * @param buffer Received bytes.
+     * @param offset Position of the frame; advanced past it when a frame is decoded.
+     * @param message The decoded message. A trade is decoded as sent: check it with
+     *        TradeSpec::validate() before pricing it.
+     * @return false if the buffer does not yet hold a complete frame.
+     * @throw std::runtime_error If the frame is malformed.
+     */
+    bool decode(const std::string& buffer, std::size_t& offset, Message& message);
+
+    /**
+     * @brief Upper bound on a frame payload (protects the server from garbage lengths).
+     */
+    const std::uint32_t MAX_FRAME_SIZE = 1 << 20;
+}
+
+#endif
@@ -0,0 +1,141 @@
+#ifndef QUANTILESKETCH_HPP
+#define QUANTILESKETCH_HPP
+
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+/**
+ * @brief Mergeable streaming quantile sketch (merging t-digest, Dunning 2019).
+ * * The sample is summarized by weighted centroids sorted by value. The k2 scale
+ * function k(q) = delta / Z * log(q / (1 - q)) bounds the weight of each
+ * centroid by about q (1 - q) n / delta, so centroids are tiny in the tails
+ * (where VaR / ES are read) and larger around the median. New values go to a small buffer that is merged
+ * into the centroids when it fills up, so add() is amortized O(log buffer).
+ * * With the default compression (200) the sketch holds at most a few hundred
+ * centroids (a few KB) whatever the number of values, and the rank error in
+ * the tails is a small fraction of the tail probability itself. Two sketches built on disjoint
+ * samples can be merged (threads, shards, checkpoints) and serialized.
+ */
+class QuantileSketch {
+
+    public:
+
+        /**
+         * @brief Creates an empty sketch.
+         * @param compression_in Accuracy / size trade-off (delta); about 2 * delta centroids at most.
+         */
+        explicit QuantileSketch(double compression_in = 200.0);
+
+        /**
+         * @brief Adds one observation (NaN values are ignored).
+         */
+        void add(double x);
+
+        /**
+         * @brief Adds n observations (one block of payoffs).
+         */
+        void add(const double* values, std::size_t n);
+
+        /**
+         * @brief Absorbs a sketch built on a disjoint sample.
+         */
+        void merge(const QuantileSketch& other);
+
+        /**
+         * @brief Merges the pending buffer into the centroids.
+         * Queries on an unflushed sketch work on a flushed copy, so engines call
+         * this once at the end of a run.
+         */
+        void flush();
+
+        std::uint64_t getCount() const { return count; }
+        double getCompression() const { return compression; }
+
+        /**
+         * @brief Smallest and largest observation (exact; 0 if empty).
+         */
+        double getMin() const { return count ? min_value : 0.0; }
+        double getMax() const { return count ? max_value : 0.0; }
+
+        /**
+         * @brief Approximate quantile, interpolated between centroids.
+         * @param q A probability in [0, 1].
+         * @return The value (0 if the sketch is empty).
+         */
+        double getQuantile(double q) const;
+
+        /**
+         * @brief Approximate cumulative distribution P(X <= x).
+         */
+        double getCDF(double x) const;
+
+        /**
+         * @brief Mean of the lower tail E[X | X <= Q(q)].
+         * @param q The tail probability in (0, 1].
+         */
+        double getLowerTailMean(double q) const;
+
+        /**
+         * @brief Mean of the upper tail E[X | X >= Q(q)].
+         * @param q The quantile level in [0, 1).
+         */
+        double getUpperTailMean(double q) const;
+
+        /**
+         * @brief Number of centroids after a flush.
+         */
+        std::size_t getCentroidCount() const;
+
+        /**
+         * @brief Heap memory used by the centroids and the buffer (bytes).
+         */
+        std::size_t getMemoryBytes() const;
+
+        /**
+         * @brief Writes the (flushed) sketch in the little-endian format of BinaryIO.
+         */
+        void writeBinary(std::ostream& os) const;
+
+        /**
+         * @brief Reads a sketch written by writeBinary().
+         * @throw std::runtime_error If the stream is truncated or invalid.
+         */
+        static QuantileSketch readBinary(std::istream& is);
+
+    private:
+
+        struct Centroid {
+            double mean;
+            double weight;
+        };
+
+        double compression;
+        std::vector<Centroid> centroids;   // sorted by mean
+        std::vector<double> buffer;        // values not yet merged
+        std::vector<Centroid> merged;      // output of compress(), reused between flushes
+        std::uint64_t count = 0;
+        double min_value = 0.0;
+        double max_value = 0.0;
+
+        std::size_t bufferCapacity() const;
+
+        static double meanOf(double x) { return x; }
+        static double meanOf(const Centroid& c) { return c.mean; }
+        static double weightOf(double) { return 1.0; }
+        static double weightOf(const Centroid& c) { return c.weight; }
+
+        /**
+         * @brief Merges a sorted list (values of weight 1, or centroids) with the
+         * current centroids and recompresses.
+         */
+        template <class Incoming>
+        void compress(const Incoming* incoming, std::size_t n);
+
+        /**
+         * @brief This sketch if its buffer is empty, otherwise a flushed copy stored in scratch.
+         */
+        const QuantileSketch& flushed(QuantileSketch& scratch) const;
+};
+
+#endif
@@ -0,0 +1,122 @@
+#ifndef TRADEFILE_HPP
+#define TRADEFILE_HPP
+
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Description of one trade to price (one line of a trade file).
+ * * Every field except option_type has a default, so a file only needs the
+ * columns it uses. Model-specific inputs (Heston v0, kappa, theta, xi, rho;
+ * Merton lambda, jump_mean, jump_vol; lattice tree_steps, american) are kept
+ * in parameters.
+ */
+struct TradeSpec {
+    std::string id;
+    std::string option_type;              // call, put, callspread, butterfly, asian
+    std::vector<double> strikes;          // 1, 2 or 3 strikes depending on the type
+    double T = 1.0;
+    double r = 0.05;
+    std::string model = "gbm";            // gbm, heston, merton
+    double S0 = 100.0;
+    double sigma = 0.2;
+    int steps = 1;
+    std::string engine = "mc";            // mc, mc-is, analytic, fourier, edp, lattice
+    double target_error = 0.0;            // MC: absolute standard error target (0 = use max_paths)
+    int max_paths = 100000;
+    std::uint64_t seed = 42;
+    std::map<std::string, double> parameters;
+    std::string error;                    // set by TradeReader on a malformed line (not priced)
+
+    /**
+     * @brief Model parameter with a default value.
+     */
+    double parameter(const std::string& name, double default_value) const;
+
+    /**
+     * @brief Checks the fields every engine relies on (option type, positive T, steps and max_paths).
+     * @throw std::runtime_error Naming the first invalid field.
+     */
+    void validate() const;
+};
+
+/**
+ * @brief Outcome of the pricing of one trade.
+ */
+struct TradeResult {
+    std::string id;
+    double price = 0.0;
+    double standard_error = 0.0;
+    long long paths = 0;
+    double seconds = 0.0;
+    std::string error;                    // empty if the pricing succeeded
+};
+
+/**
+ * @brief Incremental reader of trade files (CSV with a header line, or JSON Lines).
+ * * Only one line is held in memory at a time, so the size of the file is not a limit.
+ * CSV: the first line names the columns (any order, unknown columns are model
+ * parameters); several strikes are separated by ';' in a "strikes" column.
+ * JSONL: one flat object per line, "strikes" may be a number or an array of numbers.
+ * Blank lines and lines starting with '#' are skipped.
+ */
+class TradeReader {
+
+    public:
+
+        enum class Format { Auto, CSV, JSONL };
+
+        /**
+         * @param input_in The stream to read (must outlive the reader).
+         * @param format_in The format (Auto: JSONL if the first record starts with '{').
+         */
+        explicit TradeReader(std::istream& input_in, Format format_in = Format::Auto);
+
+        /**
+         * @brief Reads the next trade.
+         * * A malformed line does not stop the reading: the trade is returned with its id
+         * (when it could be read) and TradeSpec::error set, the message giving the line number.
+         * @param trade Filled with the trade (trades without id get their line number).
+         * @return false at the end of the file.
+         */
+        bool next(TradeSpec& trade);
+
+        Format getFormat() const { return format; }
+        std::size_t getLineNumber() const { return line_number; }
+
+    private:
+
+        bool nextRecord(std::string& line);
+        void parseCSV(const std::string& line, std::map<std::string, std::string>& fields) const;
+        void parseJSON(const std::string& line, std::map<std::string, std::string>& fields) const;
+        void toTrade(const std::map<std::string, std::string>& fields, TradeSpec& trade) const;
+
+        std::istream& input;
+        Format format;
+        std::vector<std::string> columns;     // CSV header
+        std::size_t line_number = 0;
+};
+
+/**
+ * @brief Writes pricing results as CSV (with a header line) or JSON Lines, one line per trade.
+ */
+class TradeResultWriter {
+
+    public:
+
+        TradeResultWriter(std::ostream& output_in, TradeReader::Format format_in);
+
+        void write(const TradeResult& result);
+
+    private:
+
+        std::ostream& output;
+        TradeReader::Format format;
+        bool header_written = false;
+};
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef VECTORMATH_HPP
+#define VECTORMATH_HPP
+
+#include <cstddef>
+
+/**
+ * @brief Array kernels written so that the compiler can vectorize them.
+ * * Path construction in log space (see GBM) spends its time in two array
+ * operations: the running sum of the log-increments and the exponential of the
+ * log-prices. std::exp is an opaque call that blocks vectorization and a plain
+ * running sum is one serial chain of additions; these versions avoid both.
+ */
+namespace VectorMath {
+
+    /**
+     * @brief out[i] = exp(in[i]) for every i, within 1 ulp of std::exp.
+     * * Cody-Waite reduction x = k ln2 + r with |r| <= ln2 / 2, degree-13 polynomial
+     * for e^r and exponent scaling by 2^k through the bit pattern, with no branch in
+     * the main loop. Inputs outside [-708, 709.78] (overflow, results near the
+     * subnormal range, NaN) are recomputed with std::exp afterwards.
+     * @param in Source values.
+     * @param out Destination (may be the same array as in).
+     * @param n Number of values.
+     */
+    void exp(const double* in, double* out, std::size_t n);
+
+    /**
+     * @brief In-place inclusive running sum: values[i] = start + values[0] + ... + values[i].
+     * * The array is cut into four segments whose running sums are advanced together
+     * (four independent chains instead of one), then each segment is shifted by the
+     * total of the segments before it in a vectorizable pass. The rounding
+     * differs from a left-to-right loop by a few ulps.
+     * @param values The increments, replaced by their running sums.
+     * @param n Number of values.
+     * @param start Value added to every sum.
+     */
+    void cumulativeSum(double* values, std::size_t n, double start = 0.0);
+}
+
+#endif
@@ -3,6 +3,7 @@
 #include <limits>
 #include <iomanip>
 #include <string>
+#include <algorithm>
 
 // --- CORE & INTERFACES ---
 #include "Core/Option.hpp"
@@ -22,6 +23,9 @@
 #include "PricingEngine/MonteCarloPricer.hpp"
 #include "PricingEngine/GreeksPricer.hpp"
 #include "PricingEngine/EDPSolver.hpp"
+#include "PricingEngine/AsyncPricer.hpp"
+#include "PricingEngine/FourierPricer.hpp"
+#include "PricingEngine/LatticePricer.hpp"
 
 // --- UTILS ---
 #include "Utils/GnuplotExporter.hpp"
@@ -123,6 +127,7 @@ int main() {
 
     // 4. Moteurs de pricing
     MonteCarloPricer pricer(*selectedOption, model);
+    pricer.setPayoffQuantiles(true);
     GreeksPricer greeks_pricer(*selectedOption, model);
 
     bool running = true;
@@ -132,15 +137,18 @@ int main() {
         std::cout << "2. Simulation avec Reduction de Variance (Antithetique)" << std::endl;
         std::cout << "3. Calcul des Grecs (Delta / Gamma)" << std::endl;
         std::cout << "4. Generer Graphique de Trajectoire (PNG)" << std::endl;
+        std::cout << "5. Simulation Adaptative (erreur standard cible)" << std::endl;
         
         // Action spécifique à l'EDP pour Call/Put
         if (isVanilla) {
-            std::cout << "5. Generer Courbe de Prix EDP (PNG)" << std::endl;
+            std::cout << "6. Generer Courbe de Prix EDP (PNG)" << std::endl;
+            std::cout << "7. Prix de reference Fourier (methode COS)" << std::endl;
+            std::cout << "8. Arbre binomial Leisen-Reimer (Europeen / Americain)" << std::endl;
         }
         
         std::cout << "0. Quitter" << std::endl;
         
-        int action = getSafeInt("Choix : ", 0, isVanilla ? 5 : 4);
+        int action = getSafeInt("Choix : ", 0, isVanilla ? 8 : 5);
 
         if (action == 0) {
             running = false;
@@ -153,7 +161,24 @@ int main() {
             continue;
         }
 
-        if (action == 5 && isVanilla) {
+        if (action == 5) {
+            AdaptiveSettings settings;
+            settings.target_absolute_error = getSafeDouble(">> Erreur standard cible (0 = desactivee) : ", true);
+            settings.target_relative_error = getSafeDouble(">> Erreur relative cible [ex: 0.001] (0 = desactivee) : ", true);
+            settings.time_budget_seconds = getSafeDouble(">> Budget de temps en secondes (0 = illimite) : ", true);
+            settings.max_paths = getSafeInt(">> Nombre maximal de simulations : ", 100, 10000000);
+
+            auto res = pricer.calculatePriceAdaptive(settings);
+            std::cout << "\n[RESULTAT MC ADAPTATIF]" << std::endl;
+            std::cout << "Prix estime : " << res.price << std::endl;
+            std::cout << "Erreur standard : " << res.standard_error << std::endl;
+            std::cout << "IC 95% : [" << res.confidenceInterval95Lower() << " ; " << res.confidenceInterval95Upper() << "]" << std::endl;
+            std::cout << "Simulations utilisees : " << res.paths_used << std::endl;
+            std::cout << "Arret : " << toString(res.stop_reason) << " (" << res.elapsed_seconds << " s)" << std::endl;
+            continue;
+        }
+
+        if (action == 6 && isVanilla) {
             std::cout << "Calcul de la grille EDP et generation du graphique..." << std::endl;
             EDPSolver edp(*selectedOption, model);
             // S_max réglé à 2.5 fois S0 pour voir l'allure de la courbe
@@ -163,14 +188,56 @@ int main() {
             continue;
         }
 
+        if (action == 7 && isVanilla) {
+            // Voie rapide : formule semi-analytique via la fonction caracteristique du modele
+            FourierPricer fourier(model);
+            std::cout << "\n[RESULTAT FOURIER (COS)]" << std::endl;
+            std::cout << "Prix de reference : " << fourier.price(*selectedOption) << std::endl;
+            continue;
+        }
+
+        if (action == 8 && isVanilla) {
+            int tree_steps = getSafeInt(">> Nombre de pas de l'arbre : ", 2, 20000);
+            LatticePricer lattice(*selectedOption, model);
+            LatticeSettings settings;
+            settings.type = LatticeType::LeisenReimer;
+            settings.richardson = true;
+            double european = lattice.calculatePrice(tree_steps, settings);
+            settings.exercise = ExerciseStyle::American;
+            double american = lattice.calculatePrice(tree_steps, settings);
+            std::cout << "\n[RESULTAT ARBRE BINOMIAL]" << std::endl;
+            std::cout << "Prix europeen : " << european << std::endl;
+            std::cout << "Prix americain : " << american << std::endl;
+            std::cout << "Prime d'exercice anticipe : " << american - european << std::endl;
+            continue;
+        }
+
         int n_sims = getSafeInt(">> Nombre de simulations : ", 100, 10000000);
 
         if (action == 1) {
-            auto res = pricer.calculatePrice(n_sims);
+            // Pricing asynchrone : les cotations intermédiaires s'affichent à chaque lot
+            AdaptiveSettings settings;
+            settings.max_paths = n_sims;
+            settings.batch_size = std::max(1000, n_sims / 10);
+            settings.keep_quantiles = true;
+
+            AsyncPricer async_pricer;
+            auto job = async_pricer.submitMonteCarlo(*selectedOption, model, settings,
+                [](const PricingProgress& p) {
+                    std::cout << "  [" << std::setw(3) << static_cast<int>(100.0 * p.fraction) << "%] "
+                              << p.paths << " chemins, prix = " << p.price
+                              << " (+/- " << p.standard_error << ")" << std::endl;
+                    return true;
+                });
+            auto res = job.get();
             std::cout << "\n[RESULTAT MC STANDARD]" << std::endl;
             std::cout << "Prix estime : " << res.price << std::endl;
             std::cout << "Erreur standard : " << res.standard_error << std::endl;
             std::cout << "IC 95% : [" << res.confidenceInterval95Lower() << " ; " << res.confidenceInterval95Upper() << "]" << std::endl;
+            std::cout << "Payoff (quantiles 5% / 50% / 95%) : " << res.getPayoffQuantile(0.05) << " / "
+                      << res.getPayoffQuantile(0.5) << " / " << res.getPayoffQuantile(0.95) << std::endl;
+            std::cout << "VaR 99% / ES 99% (acheteur) : " << res.getValueAtRisk(0.99) << " / "
+                      << res.getExpectedShortfall(0.99) << std::endl;
         } 
         else if (action == 2) {
             if (n_sims % 2 != 0) n_sims++; 
@@ -178,6 +245,8 @@ int main() {
             std::cout << "\n[RESULTAT MC ANTITHETIQUE]" << std::endl;
             std::cout << "Prix estime : " << res.price << std::endl;
             std::cout << "Erreur standard : " << res.standard_error << " (Variance reduite)" << std::endl;
+            std::cout << "VaR 99% / ES 99% (vendeur) : " << res.getValueAtRisk(0.99, true) << " / "
+                      << res.getExpectedShortfall(0.99, true) << std::endl;
         } 
         else if (action == 3) {
             double eps = 0.01 * S0;
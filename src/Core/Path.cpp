@@ -2,42 +2,100 @@
 #include <numeric>
 #include <algorithm>
 #include <stdexcept>
+#include <utility>
 
 Path::Path(const std::vector<double>& prices_in) : prices(prices_in) {} 
 
+Path::Path(const std::vector<double>& prices_in, std::size_t num_assets_in)
+    : prices(prices_in), num_assets(num_assets_in)
+{
+    if (num_assets == 0 || prices.size() % num_assets != 0) {
+        throw std::invalid_argument("Error: the price vector size must be a multiple of the number of assets.");
+    }
+}
+
+Path::Path(std::vector<double>&& prices_in) : prices(std::move(prices_in)) {}
+
+Path::Path(std::vector<double>&& prices_in, std::size_t num_assets_in)
+    : prices(std::move(prices_in)), num_assets(num_assets_in)
+{
+    if (num_assets == 0 || prices.size() % num_assets != 0) {
+        throw std::invalid_argument("Error: the price vector size must be a multiple of the number of assets.");
+    }
+}
+
+Path Path::view(const double* prices_in, std::size_t size, std::size_t num_assets_in) {
+    if (num_assets_in == 0 || size % num_assets_in != 0) {
+        throw std::invalid_argument("Error: the price vector size must be a multiple of the number of assets.");
+    }
+    Path path;
+    path.setView(prices_in, size, num_assets_in);
+    return path;
+}
+
+std::vector<double>& Path::data() {
+    if (view_data) {
+        prices.assign(view_data, view_data + view_size);
+        view_data = nullptr;
+        view_size = 0;
+    }
+    return prices;
+}
+
+// NOTE: the single-asset accessors only read the first series (asset 0).
+
 double Path::getFinalPrice() const {
-    if (prices.empty()){
+    if (size() == 0){
         return 0.0;
     }
-    return prices.back();
+    return values()[getLength() - 1];
 }
 
 double Path::getAveragePrice() const {
-    if (prices.empty()){
+    if (size() == 0){
         return 0.0;
     }
-    double sum = std::accumulate(prices.begin(), prices.end(), 0.0);
-    return sum / prices.size();
+    size_t length = getLength();
+    double sum = std::accumulate(values(), values() + length, 0.0);
+    return sum / length;
 }
 
 double Path::getMaxPrice() const {
-    if (prices.empty()){
+    if (size() == 0){
         return 0.0;
     }
-    return *std::max_element(prices.begin(), prices.end());
+    return *std::max_element(values(), values() + getLength());
 }
 
 double Path::getMinPrice() const {
-    if (prices.empty()){
+    if (size() == 0){
         return 0.0;
     }
-    return *std::min_element(prices.begin(), prices.end());
+    return *std::min_element(values(), values() + getLength());
 }
 
 size_t Path::getLength() const {
-    return prices.size();
+    return size() / num_assets;
 }
 
 double Path::at(size_t index) const {
-    return prices.at(index);
-};
\ No newline at end of file
+    if (index >= getLength()) {
+        throw std::out_of_range("Error: Path index out of range.");
+    }
+    return values()[index];
+}
+
+double Path::getFinalPrice(size_t asset) const {
+    if (size() == 0){
+        return 0.0;
+    }
+    return assetAt(asset, getLength() - 1);
+}
+
+double Path::assetAt(size_t asset, size_t index) const {
+    size_t length = getLength();
+    if (asset >= num_assets || index >= length) {
+        throw std::out_of_range("Error: Path asset or index out of range.");
+    }
+    return values()[asset * length + index];
+}
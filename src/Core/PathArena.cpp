@@ -0,0 +1,73 @@
+#include "Core/PathArena.hpp"
+#include "Utils/Instrumentation.hpp"
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+    // 64-byte alignment expressed in doubles
+    const std::size_t ALIGNMENT = 8;
+
+    std::size_t roundUp(std::size_t n) {
+        return (n + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    }
+}
+
+PathArena::PathArena(std::size_t initial_capacity) {
+    addChunk(std::max<std::size_t>(initial_capacity, ALIGNMENT));
+}
+
+void PathArena::addChunk(std::size_t capacity) {
+    PRICER_COUNT(Allocations, 1);
+    Chunk chunk;
+    chunk.memory.reset(new double[capacity + ALIGNMENT]);
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(chunk.memory.get());
+    std::size_t shift = (64 - address % 64) % 64 / sizeof(double);
+    chunk.begin = chunk.memory.get() + shift;
+    chunk.capacity = capacity;
+    chunks.push_back(std::move(chunk));
+}
+
+double* PathArena::allocate(std::size_t n) {
+
+    n = roundUp(n);
+    if (offset + n > chunks[current].capacity) {
+        // Next chunk (kept from a previous cycle, or a new one at least twice as large)
+        used_before += offset;
+        offset = 0;
+        ++current;
+        if (current == chunks.size() || chunks[current].capacity < n) {
+            std::size_t capacity = std::max(n, 2 * chunks.back().capacity);
+            if (current < chunks.size()) {
+                chunks.erase(chunks.begin() + static_cast<std::ptrdiff_t>(current), chunks.end());
+            }
+            addChunk(capacity);
+        }
+    }
+
+    double* block = chunks[current].begin + offset;
+    offset += n;
+    return block;
+}
+
+void PathArena::reset() {
+    // Several chunks were needed: keep a single one of the total size for the next cycles
+    if (current > 0) {
+        std::size_t total = getCapacity();
+        chunks.clear();
+        addChunk(total);
+    }
+    current = 0;
+    offset = 0;
+    used_before = 0;
+}
+
+std::size_t PathArena::getCapacity() const {
+    std::size_t total = 0;
+    for (const Chunk& chunk : chunks) total += chunk.capacity;
+    return total;
+}
+
+PathArena& PathArena::forThread() {
+    static thread_local PathArena instance;
+    return instance;
+}
@@ -0,0 +1,66 @@
+#include "Core/PathBatch.hpp"
+#include "Utils/Instrumentation.hpp"
+#include <algorithm>
+
+template <typename Real>
+BasicPathBatch<Real>::BasicPathBatch(std::size_t num_paths_in, int steps_in, std::size_t num_assets_in) {
+    resize(num_paths_in, steps_in, num_assets_in);
+}
+
+template <typename Real>
+void BasicPathBatch<Real>::resize(std::size_t num_paths_in, int steps_in, std::size_t num_assets_in) {
+    num_paths = num_paths_in;
+    steps = steps_in;
+    num_assets = num_assets_in;
+    std::size_t needed = num_assets * num_paths * static_cast<std::size_t>(steps + 1);
+    if (needed > prices.capacity()) PRICER_COUNT(Allocations, 1);
+    prices.resize(needed);
+}
+
+template <typename Real>
+void BasicPathBatch<Real>::extractPath(std::size_t p, Path& out) const {
+    const std::size_t length = static_cast<std::size_t>(steps + 1);
+    out.setView(nullptr, 0, num_assets);   // back to owned storage, without copying a previous view
+    std::vector<double>& data = out.data();
+    if (num_assets * length > data.capacity()) PRICER_COUNT(Allocations, 1);
+    data.resize(num_assets * length);
+    out.setNumAssets(num_assets);
+
+    // Rows are contiguous over paths: gather the column of path p (asset-major)
+    for (std::size_t r = 0; r < num_assets * length; ++r) {
+        data[r] = prices[r * num_paths + p];
+    }
+}
+
+template <typename Real>
+void BasicPathBatch<Real>::copyPathMajor(double* out) const {
+    const std::size_t rows = num_assets * static_cast<std::size_t>(steps + 1);
+    const std::size_t tile = 16;
+
+    // Tiled transposition: a tile of rows x paths stays in L1 on both sides
+    for (std::size_t r0 = 0; r0 < rows; r0 += tile) {
+        const std::size_t r1 = std::min(r0 + tile, rows);
+        for (std::size_t p0 = 0; p0 < num_paths; p0 += tile) {
+            const std::size_t p1 = std::min(p0 + tile, num_paths);
+            for (std::size_t p = p0; p < p1; ++p) {
+                double* dest = out + p * rows;
+                for (std::size_t r = r0; r < r1; ++r) {
+                    dest[r] = prices[r * num_paths + p];
+                }
+            }
+        }
+    }
+}
+
+template <typename Real>
+Real* BasicPathBatch<Real>::getWorkspace(std::size_t columns) {
+    std::size_t needed = columns * num_paths;
+    if (workspace.size() < needed) {
+        if (needed > workspace.capacity()) PRICER_COUNT(Allocations, 1);
+        workspace.resize(needed);
+    }
+    return workspace.data();
+}
+
+template class BasicPathBatch<double>;
+template class BasicPathBatch<float>;
@@ -0,0 +1,376 @@
+#include "Core/ScenarioFile.hpp"
+#include "Models/AssetModel.hpp"
+#include "Models/RNG.hpp"
+#include "Utils/BinaryIO.hpp"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define PRICER_HAS_MMAP 1
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace {
+
+    // "OPSC" tag followed by the format version
+    const std::uint32_t SCENARIO_MAGIC = 0x4353504F;
+    const std::uint32_t SCENARIO_VERSION = 1;
+
+    // The data section starts on a cache-line boundary
+    const std::uint64_t DATA_ALIGNMENT = 64;
+
+    // Tiled transposition of rows x num_paths values into path-major order (see PathBatch)
+    template <typename Real>
+    void transposeBlock(const Real* rows_in, std::size_t rows, std::size_t num_paths, double* out) {
+        const std::size_t tile = 16;
+        for (std::size_t r0 = 0; r0 < rows; r0 += tile) {
+            const std::size_t r1 = std::min(r0 + tile, rows);
+            for (std::size_t p0 = 0; p0 < num_paths; p0 += tile) {
+                const std::size_t p1 = std::min(p0 + tile, num_paths);
+                for (std::size_t p = p0; p < p1; ++p) {
+                    double* dest = out + p * rows;
+                    for (std::size_t r = r0; r < r1; ++r) {
+                        dest[r] = rows_in[r * num_paths + p];
+                    }
+                }
+            }
+        }
+    }
+
+    bool hostIsLittleEndian() {
+        const std::uint16_t probe = 1;
+        unsigned char first;
+        std::memcpy(&first, &probe, 1);
+        return first == 1;
+    }
+
+    void writeString(std::ostream& os, const std::string& s) {
+        BinaryIO::writeU32(os, static_cast<std::uint32_t>(s.size()));
+        os.write(s.data(), static_cast<std::streamsize>(s.size()));
+    }
+
+    std::string readString(std::istream& is) {
+        std::uint32_t size = BinaryIO::readU32(is);
+        std::string s(size, '\0');
+        if (size > 0 && !is.read(&s[0], size)) {
+            throw std::runtime_error("Error: truncated binary stream.");
+        }
+        return s;
+    }
+
+    std::uint64_t alignUp(std::uint64_t offset) {
+        return (offset + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT * DATA_ALIGNMENT;
+    }
+}
+
+// --- ScenarioWriter ---
+
+ScenarioWriter::ScenarioWriter(const std::string& filename, const ScenarioHeader& header_in)
+    : header(header_in)
+{
+    if (!hostIsLittleEndian()) {
+        throw std::runtime_error("Error: scenario files require a little-endian host.");
+    }
+    if (header.steps <= 0 || header.num_assets == 0 || header.block_paths == 0) {
+        throw std::invalid_argument("Error: a scenario header requires steps > 0, num_assets > 0 and block_paths > 0.");
+    }
+    if (header.time_grid.empty()) {
+        for (int t = 0; t <= header.steps; ++t) {
+            header.time_grid.push_back(header.maturity * t / header.steps);
+        }
+    }
+    if (header.time_grid.size() != static_cast<std::size_t>(header.steps) + 1) {
+        throw std::invalid_argument("Error: the time grid must have steps + 1 points.");
+    }
+    header.num_paths = 0;
+
+    file.open(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw std::runtime_error("Error: cannot create scenario file " + filename);
+    }
+
+    // 1. Header (num_paths is patched by close())
+    BinaryIO::writeU32(file, SCENARIO_MAGIC);
+    BinaryIO::writeU32(file, SCENARIO_VERSION);
+    BinaryIO::writeU32(file, static_cast<std::uint32_t>(header.precision));
+    BinaryIO::writeU32(file, static_cast<std::uint32_t>(header.num_assets));
+    BinaryIO::writeU32(file, static_cast<std::uint32_t>(header.steps));
+    BinaryIO::writeU32(file, static_cast<std::uint32_t>(header.block_paths));
+    count_offset = static_cast<std::uint64_t>(file.tellp());
+    BinaryIO::writeU64(file, 0);
+    BinaryIO::writeU64(file, header.seed);
+    BinaryIO::writeDouble(file, header.maturity);
+    writeString(file, header.model_name);
+    BinaryIO::writeU32(file, static_cast<std::uint32_t>(header.parameters.size()));
+    for (const auto& parameter : header.parameters) {
+        writeString(file, parameter.first);
+        BinaryIO::writeDouble(file, parameter.second);
+    }
+    for (double t : header.time_grid) {
+        BinaryIO::writeDouble(file, t);
+    }
+
+    // 2. Padding up to the data section
+    std::uint64_t position = static_cast<std::uint64_t>(file.tellp());
+    std::vector<char> padding(alignUp(position) - position, 0);
+    file.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+}
+
+ScenarioWriter::~ScenarioWriter() {
+    if (file.is_open()) {
+        try {
+            close();
+        } catch (...) {
+        }
+    }
+}
+
+void ScenarioWriter::append(const PathBatch& batch) {
+
+    if (batch.getSteps() != header.steps || batch.getNumAssets() != header.num_assets
+        || batch.getNumPaths() == 0 || batch.getNumPaths() > header.block_paths) {
+        throw std::invalid_argument("Error: the PathBatch does not match the scenario header.");
+    }
+    if (short_block_written) {
+        throw std::invalid_argument("Error: only the last block of a scenario file may be short.");
+    }
+    if (batch.getNumPaths() < header.block_paths) {
+        short_block_written = true;
+    }
+
+    // Rows are written in the PathBatch order: asset-major, then time, contiguous over paths
+    const std::size_t n = batch.getNumPaths();
+    for (std::size_t a = 0; a < header.num_assets; ++a) {
+        for (int t = 0; t <= header.steps; ++t) {
+            const double* row = batch.row(a, t);
+            if (header.precision == ScenarioPrecision::Float64) {
+                file.write(reinterpret_cast<const char*>(row), static_cast<std::streamsize>(n * sizeof(double)));
+            } else {
+                conversion.resize(n);
+                for (std::size_t p = 0; p < n; ++p) {
+                    conversion[p] = static_cast<float>(row[p]);
+                }
+                file.write(reinterpret_cast<const char*>(conversion.data()), static_cast<std::streamsize>(n * sizeof(float)));
+            }
+        }
+    }
+    header.num_paths += n;
+}
+
+void ScenarioWriter::close() {
+    if (!file.is_open()) return;
+
+    file.seekp(static_cast<std::streamoff>(count_offset));
+    BinaryIO::writeU64(file, header.num_paths);
+    file.close();
+    if (file.fail()) {
+        throw std::runtime_error("Error: failed to write the scenario file.");
+    }
+}
+
+ScenarioHeader ScenarioWriter::generate(const std::string& filename, const AssetModel& model, double T,
+                                        std::uint64_t num_paths, const ScenarioHeader& header_in)
+{
+    ScenarioHeader header = header_in;
+    header.maturity = T;
+    header.steps = model.getSteps();
+    header.num_assets = model.getNumAssets();
+    header.time_grid.clear();
+
+    ScenarioWriter writer(filename, header);
+    PathBatch batch;
+
+    // One RNG stream per block: the content does not depend on who generates it
+    std::uint64_t block_index = 0;
+    for (std::uint64_t done = 0; done < num_paths; done += header.block_paths, ++block_index) {
+        std::size_t block = static_cast<std::size_t>(std::min<std::uint64_t>(header.block_paths, num_paths - done));
+        RNG::getInstance().seed(header.seed, block_index);
+        batch.resize(block, header.steps, header.num_assets);
+        model.generatePathBatch(T, batch);
+        writer.append(batch);
+    }
+    writer.close();
+
+    header.num_paths = num_paths;
+    header.time_grid = writer.header.time_grid;
+    return header;
+}
+
+// --- ScenarioFile ---
+
+ScenarioFile::ScenarioFile(const std::string& filename) {
+
+    if (!hostIsLittleEndian()) {
+        throw std::runtime_error("Error: scenario files require a little-endian host.");
+    }
+
+    // 1. Header
+    std::ifstream input(filename, std::ios::binary);
+    if (!input.is_open()) {
+        throw std::runtime_error("Error: cannot open scenario file " + filename);
+    }
+    if (BinaryIO::readU32(input) != SCENARIO_MAGIC) {
+        throw std::runtime_error("Error: not a scenario file: " + filename);
+    }
+    if (BinaryIO::readU32(input) != SCENARIO_VERSION) {
+        throw std::runtime_error("Error: unsupported scenario file version.");
+    }
+    std::uint32_t precision = BinaryIO::readU32(input);
+    if (precision != 4 && precision != 8) {
+        throw std::runtime_error("Error: invalid scenario precision.");
+    }
+    header.precision = static_cast<ScenarioPrecision>(precision);
+    header.num_assets = BinaryIO::readU32(input);
+    header.steps = static_cast<int>(BinaryIO::readU32(input));
+    header.block_paths = BinaryIO::readU32(input);
+    header.num_paths = BinaryIO::readU64(input);
+    header.seed = BinaryIO::readU64(input);
+    header.maturity = BinaryIO::readDouble(input);
+    header.model_name = readString(input);
+    std::uint32_t num_parameters = BinaryIO::readU32(input);
+    for (std::uint32_t i = 0; i < num_parameters; ++i) {
+        std::string name = readString(input);
+        header.parameters.emplace_back(name, BinaryIO::readDouble(input));
+    }
+    if (header.steps <= 0 || header.num_assets == 0 || header.block_paths == 0) {
+        throw std::runtime_error("Error: corrupted scenario header.");
+    }
+    for (int t = 0; t <= header.steps; ++t) {
+        header.time_grid.push_back(BinaryIO::readDouble(input));
+    }
+
+    data_offset = alignUp(static_cast<std::uint64_t>(input.tellg()));
+    values_per_path = header.num_assets * (static_cast<std::size_t>(header.steps) + 1);
+
+    // num_assets and steps are 32-bit fields, so values_per_path fits in 64 bits; the
+    // byte sizes are checked before multiplying so that a corrupted header cannot wrap
+    const std::uint64_t max_size = std::numeric_limits<std::uint64_t>::max();
+    if (values_per_path > max_size / precision) {
+        throw std::runtime_error("Error: corrupted scenario header (path size overflows).");
+    }
+    const std::uint64_t path_bytes = static_cast<std::uint64_t>(values_per_path) * precision;
+    if (header.num_paths > (max_size - data_offset) / path_bytes) {
+        throw std::runtime_error("Error: corrupted scenario header (file size overflows).");
+    }
+    const std::uint64_t expected_size = data_offset + header.num_paths * path_bytes;
+    input.close();
+
+    // 2. Map the whole file read-only (shared pages between processes)
+#ifdef PRICER_HAS_MMAP
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Error: cannot open scenario file " + filename);
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || static_cast<std::uint64_t>(info.st_size) < expected_size) {
+        ::close(fd);
+        throw std::runtime_error("Error: truncated scenario file " + filename);
+    }
+    mapping_size = static_cast<std::size_t>(info.st_size);
+    void* address = ::mmap(nullptr, mapping_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (address == MAP_FAILED) {
+        throw std::runtime_error("Error: cannot map scenario file " + filename);
+    }
+    mapping = static_cast<const unsigned char*>(address);
+#else
+    std::ifstream whole(filename, std::ios::binary);
+    fallback.assign(std::istreambuf_iterator<char>(whole), std::istreambuf_iterator<char>());
+    if (fallback.size() < expected_size) {
+        throw std::runtime_error("Error: truncated scenario file " + filename);
+    }
+    mapping = fallback.data();
+    mapping_size = fallback.size();
+#endif
+}
+
+ScenarioFile::~ScenarioFile() {
+#ifdef PRICER_HAS_MMAP
+    if (mapping) {
+        ::munmap(const_cast<unsigned char*>(mapping), mapping_size);
+    }
+#endif
+}
+
+std::size_t ScenarioFile::getNumBlocks() const {
+    return static_cast<std::size_t>((header.num_paths + header.block_paths - 1) / header.block_paths);
+}
+
+std::size_t ScenarioFile::getBlockPaths(std::size_t b) const {
+    std::uint64_t start = static_cast<std::uint64_t>(b) * header.block_paths;
+    return static_cast<std::size_t>(std::min<std::uint64_t>(header.block_paths, header.num_paths - start));
+}
+
+const unsigned char* ScenarioFile::blockStart(std::size_t b) const {
+    const std::size_t bytes = static_cast<std::size_t>(header.precision);
+    return mapping + data_offset + static_cast<std::uint64_t>(b) * header.block_paths * values_per_path * bytes;
+}
+
+const double* ScenarioFile::blockData64(std::size_t b) const {
+    if (header.precision != ScenarioPrecision::Float64) {
+        throw std::logic_error("Error: the scenario file is not stored in float64.");
+    }
+    return reinterpret_cast<const double*>(blockStart(b));
+}
+
+const float* ScenarioFile::blockData32(std::size_t b) const {
+    if (header.precision != ScenarioPrecision::Float32) {
+        throw std::logic_error("Error: the scenario file is not stored in float32.");
+    }
+    return reinterpret_cast<const float*>(blockStart(b));
+}
+
+void ScenarioFile::extractPath(std::size_t b, std::size_t p, Path& out) const {
+    const std::size_t n = getBlockPaths(b);
+    out.setView(nullptr, 0, header.num_assets);   // back to owned storage, without copying a previous view
+    std::vector<double>& data = out.data();
+    data.resize(values_per_path);
+    out.setNumAssets(header.num_assets);
+
+    // Gather the column of path p (rows are contiguous over the paths of the block)
+    if (header.precision == ScenarioPrecision::Float64) {
+        const double* block = blockData64(b);
+        for (std::size_t r = 0; r < values_per_path; ++r) {
+            data[r] = block[r * n + p];
+        }
+    } else {
+        const float* block = blockData32(b);
+        for (std::size_t r = 0; r < values_per_path; ++r) {
+            data[r] = block[r * n + p];
+        }
+    }
+}
+
+void ScenarioFile::readBlock(std::size_t b, PathBatch& out) const {
+    const std::size_t n = getBlockPaths(b);
+    out.resize(n, header.steps, header.num_assets);
+
+    for (std::size_t a = 0; a < header.num_assets; ++a) {
+        for (int t = 0; t <= header.steps; ++t) {
+            std::size_t r = a * (static_cast<std::size_t>(header.steps) + 1) + static_cast<std::size_t>(t);
+            double* row = out.row(a, t);
+            if (header.precision == ScenarioPrecision::Float64) {
+                std::memcpy(row, blockData64(b) + r * n, n * sizeof(double));
+            } else {
+                const float* source = blockData32(b) + r * n;
+                for (std::size_t p = 0; p < n; ++p) {
+                    row[p] = source[p];
+                }
+            }
+        }
+    }
+}
+
+void ScenarioFile::copyPathMajor(std::size_t b, double* out) const {
+    const std::size_t n = getBlockPaths(b);
+    if (header.precision == ScenarioPrecision::Float64) {
+        transposeBlock(blockData64(b), values_per_path, n, out);
+    } else {
+        transposeBlock(blockData32(b), values_per_path, n, out);
+    }
+}
@@ -1,9 +1,60 @@
 #include "Models/AssetModel.hpp"
+#include "Models/RNG.hpp"
+#include "Utils/Instrumentation.hpp"
+#include <cmath>
+#include <stdexcept>
 
 
 AssetModel::AssetModel(double S0_in, int steps_in)
     : S0(S0_in), steps(steps_in) 
 {}
 
+double AssetModel::getDiscountFactor(double T, double r) const {
+    return std::exp(-r * T);
+}
+
 // NOTE: The pure virtual method generatePath() must be implemented 
-// by concrete derived classes (like GBM.cpp) and is NOT defined here.
\ No newline at end of file
+// by concrete derived classes (like GBM.cpp) and is NOT defined here.
+
+void AssetModel::generatePathBatch(double T, PathBatch& batch) const {
+    PRICER_TIME_SCOPE(PathConstruction);
+
+    if (batch.getSteps() != steps || batch.getNumAssets() != getNumAssets()) {
+        throw std::invalid_argument("Error: the PathBatch must have as many steps and assets as the model.");
+    }
+
+    // Generic fallback: one path at a time, scattered into the SoA rows. The draws of
+    // one path are not a row of paths, so no SamplingScheme may pair them.
+    RNG::SamplingScope independent(RNG::getInstance(), SamplingScheme());
+    for (std::size_t p = 0; p < batch.getNumPaths(); ++p) {
+        Path path = generatePath(T);
+        for (std::size_t a = 0; a < batch.getNumAssets(); ++a) {
+            for (int t = 0; t <= steps; ++t) {
+                batch.row(a, t)[p] = path.assetAt(a, t);
+            }
+        }
+    }
+}
+
+void AssetModel::generatePathBatch32(double T, PathBatch32& batch) const {
+
+    if (batch.getSteps() != steps || batch.getNumAssets() != getNumAssets()) {
+        throw std::invalid_argument("Error: the PathBatch must have as many steps and assets as the model.");
+    }
+
+    // Generic fallback: double simulation (reused per thread), rounded to float row by row
+    static thread_local PathBatch scratch;
+    scratch.resize(batch.getNumPaths(), steps, getNumAssets());
+    generatePathBatch(T, scratch);
+
+    const std::size_t n = batch.getNumPaths();
+    for (std::size_t a = 0; a < batch.getNumAssets(); ++a) {
+        for (int t = 0; t <= steps; ++t) {
+            const double* source = scratch.row(a, t);
+            float* dest = batch.row(a, t);
+            for (std::size_t p = 0; p < n; ++p) {
+                dest[p] = static_cast<float>(source[p]);
+            }
+        }
+    }
+}
@@ -0,0 +1,64 @@
+#include "Models/Curve.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+Curve::Curve(double value)
+    : times{0.0}, values{value}
+{}
+
+Curve::Curve(const std::vector<double>& times_in, const std::vector<double>& values_in)
+    : times(times_in), values(values_in)
+{
+    if (times.empty() || times.size() != values.size()) {
+        throw std::invalid_argument("Error: a Curve requires as many values as pillar times (at least one).");
+    }
+    for (std::size_t i = 1; i < times.size(); ++i) {
+        if (times[i] <= times[i - 1]) {
+            throw std::invalid_argument("Error: Curve pillar times must be strictly increasing.");
+        }
+    }
+}
+
+double Curve::value(double t) const {
+    if (t <= times.front()) return values.front();
+    if (t >= times.back()) return values.back();
+
+    // First pillar strictly after t (binary search)
+    std::size_t i = static_cast<std::size_t>(std::upper_bound(times.begin(), times.end(), t) - times.begin());
+    double w = (t - times[i - 1]) / (times[i] - times[i - 1]);
+    return values[i - 1] + w * (values[i] - values[i - 1]);
+}
+
+template <typename F>
+double Curve::integratePieces(double t0, double t1, F f) const {
+    if (t1 <= t0) return 0.0;
+
+    double total = 0.0;
+    double a = t0;
+    while (a < t1) {
+        // End of the current linear piece (next pillar after a, or t1)
+        std::size_t i = static_cast<std::size_t>(std::upper_bound(times.begin(), times.end(), a) - times.begin());
+        double b = (i < times.size()) ? std::min(times[i], t1) : t1;
+
+        double fa = f(value(a));
+        double fm = f(value(0.5 * (a + b)));
+        double fb = f(value(b));
+        total += (b - a) * (fa + 4.0 * fm + fb) / 6.0;
+        a = b;
+    }
+    return total;
+}
+
+double Curve::integral(double t0, double t1) const {
+    return integratePieces(t0, t1, [](double v) { return v; });
+}
+
+double Curve::integralOfSquare(double t0, double t1) const {
+    return integratePieces(t0, t1, [](double v) { return v * v; });
+}
+
+void Curve::appendParameters(std::vector<double>& out) const {
+    out.push_back(static_cast<double>(times.size()));
+    out.insert(out.end(), times.begin(), times.end());
+    out.insert(out.end(), values.begin(), values.end());
+}
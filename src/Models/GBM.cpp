@@ -1,8 +1,12 @@
 #include "Models/GBM.hpp"
 #include "Models/RNG.hpp" // To access the Random Number Generator Singleton
+#include "Utils/Instrumentation.hpp"
+#include "Utils/VectorMath.hpp"
 #include <cmath>
 #include <vector>
 #include <algorithm>
+#include <stdexcept>
+#include <utility>
 
 GBM::GBM(double S0_in, int steps_in, double mu_in, double sigma_in)
     : AssetModel(S0_in, steps_in), mu(mu_in), sigma(sigma_in) 
@@ -21,72 +25,110 @@ Path GBM::generatePath(double T) const {
     // Volatility factor for the stochastic term: sigma * sqrt(dt)
     double vol_term_factor = sigma * std::sqrt(dt);
 
-    // 3. Initialize path container
-    std::vector<double> prices_data;
-    prices_data.reserve(steps + 1);
-    
-    // Start with the initial price S0
-    prices_data.push_back(S0); 
-
-    double current_price = S0;
+    // 3. Log-increments of every step in bulk: drift + vol * Z (same draws as step by step)
+    std::vector<double> prices_data(static_cast<std::size_t>(steps) + 1);
+    double* log_prices = prices_data.data();
+    log_prices[0] = 0.0;
+    RNG::getInstance().fillStandardNormal(log_prices + 1, static_cast<std::size_t>(steps));
+    for (int i = 1; i <= steps; ++i) {
+        log_prices[i] = drift_term + vol_term_factor * log_prices[i];
+    }
 
-    // 4. Loop through time steps to generate the trajectory
-    for (int i = 0; i < steps; ++i) {
-        
-        // Obtain a standard normal random variable Z ~ N(0, 1) via the RNG Singleton
-        double Z = RNG::getInstance().getStandardNormal(); 
-        
-        // 5. Apply the discrete GBM update formula
-        current_price *= std::exp(drift_term + vol_term_factor * Z);
+    // 4. log(S_t / S0) is the running sum of the increments
+    VectorMath::cumulativeSum(log_prices + 1, static_cast<std::size_t>(steps));
 
-        prices_data.push_back(current_price);
+    // 5. S_t = S0 * exp(log(S_t / S0)) over the whole array (S_0 = S0 exactly)
+    VectorMath::exp(log_prices, log_prices, prices_data.size());
+    for (double& price : prices_data) {
+        price *= S0;
     }
     
     // 6. Return the constructed Path object
-    return Path(prices_data);
+    return Path(std::move(prices_data));
 }
 
 std::pair<Path, Path> GBM::generateMinVarPaths(double T) const {
-    
-    // 1. Pré-calcul des constantes
-    double dt = T / steps; 
+    Path path_std;
+    Path path_anti;
+    generateMinVarPaths(T, path_std, path_anti);
+    return std::make_pair(std::move(path_std), std::move(path_anti));
+}
+
+void GBM::generateMinVarPaths(double T, Path& path_std, Path& path_anti) const {
+
+    // 1. Two paths of one batch: with antithetic sampling, path 1 uses -Z wherever path 0 uses Z
+    static thread_local PathBatch pair;
+    pair.resize(2, steps);
+    {
+        RNG::SamplingScope antithetic(RNG::getInstance(), SamplingScheme{true, false});
+        generatePathBatch(T, pair);
+    }
+
+    // 2. Copy into the caller's paths (storage reused)
+    pair.extractPath(0, path_std);
+    pair.extractPath(1, path_anti);
+}
+
+void GBM::generatePathBatch(double T, PathBatch& batch) const {
+    PRICER_TIME_SCOPE(PathConstruction);
+
+    if (batch.getSteps() != steps || batch.getNumAssets() != 1) {
+        throw std::invalid_argument("Error: the PathBatch must have as many steps and assets as the model.");
+    }
+
+    // 1. Constant terms (same as generatePath)
+    double dt = T / steps;
     double drift_term = (mu - 0.5 * sigma * sigma) * dt;
     double vol_term_factor = sigma * std::sqrt(dt);
 
-    // 2. Initialisation des deux trajectoires
-    std::vector<double> prices_std;
-    std::vector<double> prices_anti;
-    prices_std.reserve(steps + 1);
-    prices_anti.reserve(steps + 1);
-    
-    // Initialisation des prix (S0 est commun)
-    prices_std.push_back(S0); 
-    prices_anti.push_back(S0);
-    
-    double current_price_std = S0;
-    double current_price_anti = S0;
-
-    // 3. Boucle de simulation (N/2 itérations nécessaires si on génère les paires)
-    for (int i = 0; i < steps; ++i) {
-        
-        // A. Générer un seul nombre normal Z
-        double Z = RNG::getInstance().getStandardNormal(); 
-        
-        // B. Calculer les termes stochastiques pour Z et -Z
-        double stoch_term_std = vol_term_factor * Z;    // Terme standard
-        double stoch_term_anti = vol_term_factor * (-Z); // Terme antithétique
-        
-        // C. Mettre à jour le chemin standard (utilise Z)
-        current_price_std *= std::exp(drift_term + stoch_term_std);
-        prices_std.push_back(current_price_std);
-
-        // D. Mettre à jour le chemin antithétique (utilise -Z)
-        current_price_anti *= std::exp(drift_term + stoch_term_anti);
-        prices_anti.push_back(current_price_anti);
+    const std::size_t n = batch.getNumPaths();
+    double* Z = batch.getWorkspace(1);
+    RNG& rng = RNG::getInstance();
+
+    // 2. Every path starts at S0
+    std::fill(batch.row(0), batch.row(0) + n, S0);
+
+    // 3. Step-by-step update across all paths (contiguous rows: vectorizable)
+    for (int t = 0; t < steps; ++t) {
+        rng.fillStandardNormal(Z, n);
+        for (std::size_t p = 0; p < n; ++p) {
+            Z[p] = drift_term + vol_term_factor * Z[p];
+        }
+        VectorMath::exp(Z, Z, n);
+        const double* current = batch.row(t);
+        double* next = batch.row(t + 1);
+        for (std::size_t p = 0; p < n; ++p) {
+            next[p] = current[p] * Z[p];
+        }
     }
-    
-    // 4. Retourner la paire de chemins
-    return std::make_pair(Path(prices_std), Path(prices_anti));
 }
 
+void GBM::generatePathBatch32(double T, PathBatch32& batch) const {
+    PRICER_TIME_SCOPE(PathConstruction);
 
+    if (batch.getSteps() != steps || batch.getNumAssets() != 1) {
+        throw std::invalid_argument("Error: the PathBatch must have as many steps and assets as the model.");
+    }
+
+    // 1. Constant terms in double, rounded once
+    double dt = T / steps;
+    const float drift_term = static_cast<float>((mu - 0.5 * sigma * sigma) * dt);
+    const float vol_term_factor = static_cast<float>(sigma * std::sqrt(dt));
+
+    const std::size_t n = batch.getNumPaths();
+    float* Z = batch.getWorkspace(1);
+    RNG& rng = RNG::getInstance();
+
+    // 2. Every path starts at S0
+    std::fill(batch.row(0), batch.row(0) + n, static_cast<float>(S0));
+
+    // 3. Same update as generatePathBatch, in float
+    for (int t = 0; t < steps; ++t) {
+        rng.fillStandardNormal(Z, n);
+        const float* current = batch.row(t);
+        float* next = batch.row(t + 1);
+        for (std::size_t p = 0; p < n; ++p) {
+            next[p] = current[p] * std::exp(drift_term + vol_term_factor * Z[p]);
+        }
+    }
+}
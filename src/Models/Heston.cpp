@@ -0,0 +1,147 @@
+#include "Models/Heston.hpp"
+#include "Models/RNG.hpp"
+#include "Utils/Instrumentation.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+#include <utility>
+
+namespace {
+    // Switching level between the quadratic and the exponential branch of QE
+    const double PSI_CRITICAL = 1.5;
+}
+
+Heston::Heston(double S0_in, int steps_in, double mu_in, double v0_in, double kappa_in,
+               double theta_in, double xi_in, double rho_in, Scheme scheme_in)
+    : AssetModel(S0_in, steps_in), mu(mu_in), v0(v0_in), kappa(kappa_in),
+      theta(theta_in), xi(xi_in), rho(rho_in), scheme(scheme_in)
+{
+    if (v0 < 0.0 || kappa <= 0.0 || theta <= 0.0 || xi <= 0.0 || rho < -1.0 || rho > 1.0) {
+        throw std::invalid_argument("Error: Heston requires v0 >= 0, kappa > 0, theta > 0, xi > 0 and -1 <= rho <= 1.");
+    }
+}
+
+void Heston::step(double dt, double* log_s, double* v, double* draw1, double* draw2, std::size_t n) const {
+
+    RNG& rng = RNG::getInstance();
+
+    if (scheme == Scheme::FullTruncation) {
+
+        // 1. Independent normals: draw1 drives the variance, draw2 the orthogonal spot part
+        rng.fillStandardNormal(draw1, n);
+        rng.fillStandardNormal(draw2, n);
+
+        const double rho_perp = std::sqrt(1.0 - rho * rho);
+
+        // 2. Euler step with v+ = max(v, 0) in drift and diffusion
+        for (std::size_t p = 0; p < n; ++p) {
+            double v_plus = std::max(v[p], 0.0);
+            double sqrt_v_dt = std::sqrt(v_plus * dt);
+            double Z_spot = rho * draw1[p] + rho_perp * draw2[p];
+
+            log_s[p] += (mu - 0.5 * v_plus) * dt + sqrt_v_dt * Z_spot;
+            v[p] += kappa * (theta - v_plus) * dt + xi * sqrt_v_dt * draw1[p];
+        }
+        return;
+    }
+
+    // --- Quadratic Exponential scheme ---
+
+    // 1. Step constants (conditional moments of v and log-spot coefficients)
+    const double e = std::exp(-kappa * dt);
+    const double c1 = xi * xi * e * (1.0 - e) / kappa;
+    const double c2 = theta * xi * xi * (1.0 - e) * (1.0 - e) / (2.0 * kappa);
+
+    const double K0 = -rho * kappa * theta * dt / xi;
+    const double K1 = 0.5 * dt * (kappa * rho / xi - 0.5) - rho / xi;
+    const double K2 = 0.5 * dt * (kappa * rho / xi - 0.5) + rho / xi;
+    const double K3 = 0.5 * dt * (1.0 - rho * rho);
+    const double K4 = K3;
+
+    // 2. Draws: draw1 = normal for the variance (Zv = Phi^-1(U), so the uniform of the
+    // exponential branch is U = Phi(Zv)), draw2 = normal for the spot. Both go through
+    // fillStandardNormal, hence the SamplingScheme: an antithetic Zv gives 1 - U
+    rng.fillStandardNormal(draw1, n);
+    rng.fillStandardNormal(draw2, n);
+
+    // 3. Variance and log-spot update for every path
+    for (std::size_t p = 0; p < n; ++p) {
+        double v_now = v[p];
+        double m = theta + (v_now - theta) * e;
+        double s2 = v_now * c1 + c2;
+        double psi = s2 / (m * m);
+        double v_next;
+
+        if (psi <= PSI_CRITICAL) {
+            // Quadratic branch: v' = a * (b + Zv)^2
+            double inv_psi = 2.0 / psi;
+            double b2 = inv_psi - 1.0 + std::sqrt(inv_psi * (inv_psi - 1.0));
+            double a = m / (1.0 + b2);
+            double b = std::sqrt(b2) + draw1[p];
+            v_next = a * b * b;
+        } else {
+            // Exponential branch: mass at zero plus an exponential tail
+            double prob_zero = (psi - 1.0) / (psi + 1.0);
+            double beta = (1.0 - prob_zero) / m;
+            // 1 - U = Phi(-Zv) from erfc, which keeps its precision in the upper tail
+            double one_minus_U = 0.5 * std::erfc(draw1[p] / std::sqrt(2.0));
+            v_next = (1.0 - one_minus_U <= prob_zero) ? 0.0 : std::log((1.0 - prob_zero) / one_minus_U) / beta;
+        }
+
+        log_s[p] += mu * dt + K0 + K1 * v_now + K2 * v_next
+                  + std::sqrt(K3 * v_now + K4 * v_next) * draw2[p];
+        v[p] = v_next;
+    }
+}
+
+Path Heston::generatePath(double T) const {
+
+    double dt = T / steps;
+
+    double log_s = std::log(S0);
+    double v = v0;
+    double draw1 = 0.0, draw2 = 0.0;
+
+    std::vector<double> prices_data;
+    prices_data.reserve(steps + 1);
+    prices_data.push_back(S0);
+
+    for (int i = 0; i < steps; ++i) {
+        step(dt, &log_s, &v, &draw1, &draw2, 1);
+        prices_data.push_back(std::exp(log_s));
+    }
+
+    return Path(std::move(prices_data));
+}
+
+void Heston::generatePathBatch(double T, PathBatch& batch) const {
+    PRICER_TIME_SCOPE(PathConstruction);
+
+    if (batch.getSteps() != steps || batch.getNumAssets() != 1) {
+        throw std::invalid_argument("Error: the PathBatch must have as many steps and assets as the model.");
+    }
+
+    const double dt = T / steps;
+    const std::size_t n = batch.getNumPaths();
+
+    // 1. SoA state: log-spot and variance of all paths, plus two draw arrays
+    double* work = batch.getWorkspace(4);
+    double* log_s = work;
+    double* v = work + n;
+    double* draw1 = work + 2 * n;
+    double* draw2 = work + 3 * n;
+
+    std::fill(log_s, log_s + n, std::log(S0));
+    std::fill(v, v + n, v0);
+    std::fill(batch.row(0), batch.row(0) + n, S0);
+
+    // 2. Time stepping across all paths
+    for (int t = 0; t < steps; ++t) {
+        step(dt, log_s, v, draw1, draw2, n);
+        double* prices = batch.row(t + 1);
+        for (std::size_t p = 0; p < n; ++p) {
+            prices[p] = std::exp(log_s[p]);
+        }
+    }
+}
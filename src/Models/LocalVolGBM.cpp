@@ -0,0 +1,113 @@
+#include "Models/LocalVolGBM.hpp"
+#include "Models/RNG.hpp"
+#include "Utils/Instrumentation.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+LocalVolGBM::LocalVolGBM(double S0_in, int steps_in, const Curve& rate_in, const LocalVolSurface& surface_in,
+                         double horizon_in)
+    : AssetModel(S0_in, steps_in), rate(rate_in), surface(surface_in)
+{
+    tables = buildTables(horizon_in);
+}
+
+LocalVolGBM::StepTables LocalVolGBM::buildTables(double T) const {
+    StepTables out;
+    out.horizon = T;
+    out.dt = T / steps;
+    out.rate_integral.resize(steps);
+
+    const std::size_t num_spots = surface.getNumSpots();
+    out.vol_slices.resize(static_cast<std::size_t>(steps) * num_spots);
+
+    for (int i = 0; i < steps; ++i) {
+        double t0 = i * out.dt;
+        out.rate_integral[i] = rate.integral(t0, t0 + out.dt);
+        // Euler: the volatility is frozen at the start of the step
+        surface.timeSlice(t0, out.vol_slices.data() + static_cast<std::size_t>(i) * num_spots);
+    }
+    return out;
+}
+
+Path LocalVolGBM::generatePath(double T) const {
+
+    // 1. Step tables of the requested maturity (precomputed unless T differs)
+    StepTables local;
+    const StepTables* table = &tables;
+    if (T != tables.horizon) {
+        local = buildTables(T);
+        table = &local;
+    }
+
+    const std::size_t num_spots = surface.getNumSpots();
+    const double dt = table->dt;
+    const double sqrt_dt = std::sqrt(dt);
+
+    std::vector<double> prices_data;
+    prices_data.reserve(steps + 1);
+    prices_data.push_back(S0);
+
+    // 2. Log-Euler update with the local volatility of the current spot
+    double current_price = S0;
+    for (int i = 0; i < steps; ++i) {
+        const double* slice = table->vol_slices.data() + static_cast<std::size_t>(i) * num_spots;
+        double sigma = surface.interpolateSlice(slice, current_price);
+        double Z = RNG::getInstance().getStandardNormal();
+        current_price *= std::exp(table->rate_integral[i] - 0.5 * sigma * sigma * dt + sigma * sqrt_dt * Z);
+        prices_data.push_back(current_price);
+    }
+
+    return Path(std::move(prices_data));
+}
+
+void LocalVolGBM::generatePathBatch(double T, PathBatch& batch) const {
+    PRICER_TIME_SCOPE(PathConstruction);
+
+    if (batch.getSteps() != steps || batch.getNumAssets() != 1) {
+        throw std::invalid_argument("Error: the PathBatch must have as many steps and assets as the model.");
+    }
+
+    // 1. Step tables of the requested maturity
+    StepTables local;
+    const StepTables* table = &tables;
+    if (T != tables.horizon) {
+        local = buildTables(T);
+        table = &local;
+    }
+
+    const std::size_t num_spots = surface.getNumSpots();
+    const double dt = table->dt;
+    const double sqrt_dt = std::sqrt(dt);
+
+    const std::size_t n = batch.getNumPaths();
+    double* Z = batch.getWorkspace(1);
+    RNG& rng = RNG::getInstance();
+
+    std::fill(batch.row(0), batch.row(0) + n, S0);
+
+    // 2. Step-by-step update across all paths
+    for (int t = 0; t < steps; ++t) {
+        rng.fillStandardNormal(Z, n);
+        const double* slice = table->vol_slices.data() + static_cast<std::size_t>(t) * num_spots;
+        const double rate_term = table->rate_integral[t];
+        const double* current = batch.row(t);
+        double* next = batch.row(t + 1);
+        for (std::size_t p = 0; p < n; ++p) {
+            double sigma = surface.interpolateSlice(slice, current[p]);
+            next[p] = current[p] * std::exp(rate_term - 0.5 * sigma * sigma * dt + sigma * sqrt_dt * Z[p]);
+        }
+    }
+}
+
+double LocalVolGBM::getDiscountFactor(double T, double /*r*/) const {
+    return std::exp(-rate.integral(0.0, T));
+}
+
+std::vector<double> LocalVolGBM::getParameters() const {
+    std::vector<double> parameters = {S0, static_cast<double>(steps)};
+    rate.appendParameters(parameters);
+    surface.appendParameters(parameters);
+    return parameters;
+}
@@ -0,0 +1,86 @@
+#include "Models/LocalVolSurface.hpp"
+#include <stdexcept>
+
+LocalVolSurface::LocalVolSurface(double t_min_in, double t_max_in, std::size_t num_times_in,
+                                 double s_min_in, double s_max_in, std::size_t num_spots_in,
+                                 const std::vector<double>& vols_in)
+    : t_min(t_min_in), num_times(num_times_in), s_min(s_min_in), num_spots(num_spots_in), vols(vols_in)
+{
+    if (num_times < 2 || num_spots < 2 || t_max_in <= t_min_in || s_max_in <= s_min_in) {
+        throw std::invalid_argument("Error: LocalVolSurface requires at least 2 x 2 nodes on increasing axes.");
+    }
+    if (vols.size() != num_times * num_spots) {
+        throw std::invalid_argument("Error: LocalVolSurface requires num_times * num_spots volatilities.");
+    }
+
+    inv_dt = static_cast<double>(num_times - 1) / (t_max_in - t_min_in);
+    inv_ds = static_cast<double>(num_spots - 1) / (s_max_in - s_min_in);
+    max_time_index = static_cast<double>(num_times - 1);
+    max_spot_index = static_cast<double>(num_spots - 1);
+}
+
+LocalVolSurface LocalVolSurface::fromFunction(double t_min, double t_max, std::size_t num_times,
+                                              double s_min, double s_max, std::size_t num_spots,
+                                              const std::function<double(double, double)>& sigma)
+{
+    if (num_times < 2 || num_spots < 2) {
+        throw std::invalid_argument("Error: LocalVolSurface requires at least 2 x 2 nodes on increasing axes.");
+    }
+
+    std::vector<double> grid(num_times * num_spots);
+    for (std::size_t i = 0; i < num_times; ++i) {
+        double t = t_min + (t_max - t_min) * static_cast<double>(i) / static_cast<double>(num_times - 1);
+        for (std::size_t j = 0; j < num_spots; ++j) {
+            double S = s_min + (s_max - s_min) * static_cast<double>(j) / static_cast<double>(num_spots - 1);
+            grid[i * num_spots + j] = sigma(t, S);
+        }
+    }
+    return LocalVolSurface(t_min, t_max, num_times, s_min, s_max, num_spots, grid);
+}
+
+void LocalVolSurface::timeSlice(double t, double* out) const {
+    // 1. Locate t on the uniform time axis (clamped)
+    double x = (t - t_min) * inv_dt;
+    x = x < 0.0 ? 0.0 : (x > max_time_index ? max_time_index : x);
+    std::size_t i = static_cast<std::size_t>(x);
+    if (i >= num_times - 1) i = num_times - 2;
+    double w = x - static_cast<double>(i);
+
+    // 2. Blend the two surrounding time rows
+    const double* lower = vols.data() + i * num_spots;
+    const double* upper = lower + num_spots;
+    for (std::size_t j = 0; j < num_spots; ++j) {
+        out[j] = lower[j] + w * (upper[j] - lower[j]);
+    }
+}
+
+double LocalVolSurface::vol(double t, double S) const {
+    // Time interpolation of the two spot nodes around S, then spot interpolation
+    double x = (t - t_min) * inv_dt;
+    x = x < 0.0 ? 0.0 : (x > max_time_index ? max_time_index : x);
+    std::size_t i = static_cast<std::size_t>(x);
+    if (i >= num_times - 1) i = num_times - 2;
+    double wt = x - static_cast<double>(i);
+
+    double y = (S - s_min) * inv_ds;
+    y = y < 0.0 ? 0.0 : (y > max_spot_index ? max_spot_index : y);
+    std::size_t j = static_cast<std::size_t>(y);
+    if (j >= num_spots - 1) j = num_spots - 2;
+    double ws = y - static_cast<double>(j);
+
+    const double* lower = vols.data() + i * num_spots + j;
+    const double* upper = lower + num_spots;
+    double v_low = lower[0] + ws * (lower[1] - lower[0]);
+    double v_up = upper[0] + ws * (upper[1] - upper[0]);
+    return v_low + wt * (v_up - v_low);
+}
+
+void LocalVolSurface::appendParameters(std::vector<double>& out) const {
+    out.push_back(t_min);
+    out.push_back(inv_dt);
+    out.push_back(static_cast<double>(num_times));
+    out.push_back(s_min);
+    out.push_back(inv_ds);
+    out.push_back(static_cast<double>(num_spots));
+    out.insert(out.end(), vols.begin(), vols.end());
+}
@@ -0,0 +1,114 @@
+#include "Models/Merton.hpp"
+#include "Models/RNG.hpp"
+#include "Utils/Instrumentation.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+#include <utility>
+
+Merton::Merton(double S0_in, int steps_in, double mu_in, double sigma_in,
+               double lambda_in, double jump_mean_in, double jump_vol_in)
+    : AssetModel(S0_in, steps_in), mu(mu_in), sigma(sigma_in), lambda(lambda_in),
+      jump_mean(jump_mean_in), jump_vol(jump_vol_in)
+{
+    if (sigma < 0.0 || lambda < 0.0 || jump_vol < 0.0) {
+        throw std::invalid_argument("Error: Merton requires sigma >= 0, lambda >= 0 and jump_vol >= 0.");
+    }
+}
+
+double Merton::getMeanJumpSize() const {
+    return std::exp(jump_mean + 0.5 * jump_vol * jump_vol) - 1.0;
+}
+
+Path Merton::generatePath(double T) const {
+
+    // 1. Constant terms (compensated drift)
+    double dt = T / steps;
+    double drift_term = (mu - 0.5 * sigma * sigma - lambda * getMeanJumpSize()) * dt;
+    double vol_term_factor = sigma * std::sqrt(dt);
+
+    RNG& rng = RNG::getInstance();
+
+    std::vector<double> prices_data;
+    prices_data.reserve(steps + 1);
+    prices_data.push_back(S0);
+
+    double current_price = S0;
+
+    // 2. Diffusion plus the aggregated jumps of each step
+    for (int i = 0; i < steps; ++i) {
+        double Z = rng.getStandardNormal();
+        double jumps = 0.0;
+        rng.fillPoisson(&jumps, 1, lambda * dt);
+
+        double log_increment = drift_term + vol_term_factor * Z;
+        if (jumps > 0.0) {
+            log_increment += jumps * jump_mean + jump_vol * std::sqrt(jumps) * rng.getStandardNormal();
+        }
+        current_price *= std::exp(log_increment);
+        prices_data.push_back(current_price);
+    }
+
+    return Path(std::move(prices_data));
+}
+
+void Merton::generatePathBatch(double T, PathBatch& batch) const {
+    PRICER_TIME_SCOPE(PathConstruction);
+
+    if (batch.getSteps() != steps || batch.getNumAssets() != 1) {
+        throw std::invalid_argument("Error: the PathBatch must have as many steps and assets as the model.");
+    }
+
+    // 1. Constant terms (same as generatePath)
+    const double dt = T / steps;
+    const double drift_term = (mu - 0.5 * sigma * sigma - lambda * getMeanJumpSize()) * dt;
+    const double vol_term_factor = sigma * std::sqrt(dt);
+    const double jump_var = jump_vol * jump_vol;
+
+    const std::size_t n = batch.getNumPaths();
+    double* work = batch.getWorkspace(3);
+    double* Z = work;
+    double* jumps = work + n;
+    double* jump_Z = work + 2 * n;
+    RNG& rng = RNG::getInstance();
+
+    std::fill(batch.row(0), batch.row(0) + n, S0);
+
+    // 2. Terminal-only case: exact sampling of the compound distribution (one normal per path)
+    if (steps == 1) {
+        rng.fillPoisson(jumps, n, lambda * dt);
+        rng.fillStandardNormal(Z, n);
+        const double diffusion_var = sigma * sigma * dt;
+        double* final_prices = batch.row(1);
+        for (std::size_t p = 0; p < n; ++p) {
+            double std_dev = std::sqrt(diffusion_var + jumps[p] * jump_var);
+            final_prices[p] = S0 * std::exp(drift_term + jumps[p] * jump_mean + std_dev * Z[p]);
+        }
+        return;
+    }
+
+    // 3. Step-by-step update across all paths
+    for (int t = 0; t < steps; ++t) {
+
+        // A. Bulk draws: diffusion normals, jump counts and jump-size normals (one row each,
+        // so that antithetic pairing and moment matching reach every driver)
+        rng.fillStandardNormal(Z, n);
+        rng.fillPoisson(jumps, n, lambda * dt);
+        rng.fillStandardNormal(jump_Z, n);
+
+        // B. Branch-free diffusion update (vectorizable)
+        const double* current = batch.row(t);
+        double* next = batch.row(t + 1);
+        for (std::size_t p = 0; p < n; ++p) {
+            next[p] = current[p] * std::exp(drift_term + vol_term_factor * Z[p]);
+        }
+
+        // C. Lognormal jump factor only on the paths that jump
+        for (std::size_t p = 0; p < n; ++p) {
+            if (jumps[p] > 0.0) {
+                next[p] *= std::exp(jumps[p] * jump_mean + jump_vol * std::sqrt(jumps[p]) * jump_Z[p]);
+            }
+        }
+    }
+}
@@ -0,0 +1,134 @@
+#include "Models/MultiAssetGBM.hpp"
+#include "Models/RNG.hpp"
+#include "Utils/Instrumentation.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    // Tile size of the blocked correlation product (rows and columns of L)
+    const std::size_t CORRELATION_BLOCK = 8;
+}
+
+MultiAssetGBM::MultiAssetGBM(const std::vector<double>& S0s_in, int steps_in, double mu_in,
+                             const std::vector<double>& sigmas_in,
+                             const std::vector<std::vector<double>>& correlation_in)
+    : AssetModel(S0s_in.empty() ? 0.0 : S0s_in[0], steps_in),
+      S0s(S0s_in), mu(mu_in), sigmas(sigmas_in)
+{
+    const std::size_t n = S0s.size();
+
+    if (n == 0 || sigmas.size() != n || correlation_in.size() != n) {
+        throw std::invalid_argument("Error: MultiAssetGBM requires one S0, one sigma and one correlation row per asset.");
+    }
+    for (const std::vector<double>& line : correlation_in) {
+        if (line.size() != n) {
+            throw std::invalid_argument("Error: the correlation matrix must be square.");
+        }
+    }
+
+    // Cholesky factorization rho = L * L^T (computed once)
+    cholesky.assign(n * n, 0.0);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j <= i; ++j) {
+            if (std::abs(correlation_in[i][j] - correlation_in[j][i]) > 1e-12) {
+                throw std::invalid_argument("Error: the correlation matrix must be symmetric.");
+            }
+            double sum = correlation_in[i][j];
+            for (std::size_t k = 0; k < j; ++k) {
+                sum -= cholesky[i * n + k] * cholesky[j * n + k];
+            }
+            if (i == j) {
+                if (sum <= 0.0) {
+                    throw std::invalid_argument("Error: the correlation matrix is not positive definite.");
+                }
+                cholesky[i * n + i] = std::sqrt(sum);
+            } else {
+                cholesky[i * n + j] = sum / cholesky[j * n + j];
+            }
+        }
+    }
+}
+
+Path MultiAssetGBM::generatePath(double T) const {
+    PathBatch batch(1, steps, S0s.size());
+    generatePathBatch(T, batch);
+
+    Path path;
+    batch.extractPath(0, path);
+    return path;
+}
+
+void MultiAssetGBM::generatePathBatch(double T, PathBatch& batch) const {
+    PRICER_TIME_SCOPE(PathConstruction);
+
+    const std::size_t num_assets = S0s.size();
+    if (batch.getSteps() != steps || batch.getNumAssets() != num_assets) {
+        throw std::invalid_argument("Error: the PathBatch must have as many steps and assets as the model.");
+    }
+
+    const std::size_t n = batch.getNumPaths();
+    const double dt = T / steps;
+    const double sqrt_dt = std::sqrt(dt);
+
+    // 1. Workspace: independent draws Z and correlated draws W, one row of n paths per asset
+    double* work = batch.getWorkspace(2 * num_assets);
+    double* Z = work;
+    double* W = work + num_assets * n;
+
+    for (std::size_t a = 0; a < num_assets; ++a) {
+        std::fill(batch.row(a, 0), batch.row(a, 0) + n, S0s[a]);
+    }
+
+    RNG& rng = RNG::getInstance();
+
+    for (int t = 0; t < steps; ++t) {
+
+        // 2. Independent normals for every (asset, path), one row of paths per call so
+        // that a SamplingScheme pairs paths of the same asset, never two assets
+        for (std::size_t a = 0; a < num_assets; ++a) {
+            rng.fillStandardNormal(Z + a * n, n);
+        }
+
+        // 3. Blocked lower-triangular product W = L * Z (inner loop over the paths)
+        std::fill(W, W + num_assets * n, 0.0);
+        for (std::size_t i0 = 0; i0 < num_assets; i0 += CORRELATION_BLOCK) {
+            std::size_t i1 = std::min(i0 + CORRELATION_BLOCK, num_assets);
+            for (std::size_t j0 = 0; j0 < i1; j0 += CORRELATION_BLOCK) {
+                for (std::size_t i = i0; i < i1; ++i) {
+                    double* W_i = W + i * n;
+                    std::size_t j1 = std::min(j0 + CORRELATION_BLOCK, i + 1);
+                    for (std::size_t j = j0; j < j1; ++j) {
+                        const double l_ij = cholesky[i * num_assets + j];
+                        const double* Z_j = Z + j * n;
+                        for (std::size_t p = 0; p < n; ++p) {
+                            W_i[p] += l_ij * Z_j[p];
+                        }
+                    }
+                }
+            }
+        }
+
+        // 4. GBM update of each asset with its correlated increment
+        for (std::size_t a = 0; a < num_assets; ++a) {
+            const double drift_term = (mu - 0.5 * sigmas[a] * sigmas[a]) * dt;
+            const double vol_term_factor = sigmas[a] * sqrt_dt;
+            const double* current = batch.row(a, t);
+            const double* W_a = W + a * n;
+            double* next = batch.row(a, t + 1);
+            for (std::size_t p = 0; p < n; ++p) {
+                next[p] = current[p] * std::exp(drift_term + vol_term_factor * W_a[p]);
+            }
+        }
+    }
+}
+
+std::vector<double> MultiAssetGBM::getParameters() const {
+    // Base order first (S0 of the first asset, steps), then the other spots
+    std::vector<double> parameters = {S0s[0], static_cast<double>(steps)};
+    parameters.insert(parameters.end(), S0s.begin() + 1, S0s.end());
+    parameters.push_back(mu);
+    parameters.insert(parameters.end(), sigmas.begin(), sigmas.end());
+    parameters.insert(parameters.end(), cholesky.begin(), cholesky.end());
+    return parameters;
+}
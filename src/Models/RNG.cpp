@@ -1,18 +1,131 @@
 #include "Models/RNG.hpp"
+#include "Utils/BlackScholesFormulas.hpp"
+#include "Utils/Instrumentation.hpp"
+#include <cmath>
 #include <chrono> // Required for seeding the generator
+#include <functional>
+#include <thread>
 
 RNG::RNG() 
-    : generator(std::chrono::high_resolution_clock::now().time_since_epoch().count()), 
+    : generator(), 
       // Initialize the normal distribution to be N(0, 1) (mean=0.0, std_dev=1.0).
-      normal_dist(0.0, 1.0) 
-{}
+      normal_dist(0.0, 1.0),
+      normal_dist_float(0.0f, 1.0f),
+      uniform_dist(0.0, 1.0)
+{
+    // Clock and thread id are mixed so that threads created together get different streams
+    std::uint64_t time_seed = static_cast<std::uint64_t>(
+        std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    std::uint64_t thread_seed = std::hash<std::thread::id>()(std::this_thread::get_id());
+    seed(time_seed, thread_seed);
+}
 
 RNG& RNG::getInstance() {
-    // The instance is created on first access.
-    static RNG instance;
+    // The instance of each thread is created on its first access.
+    static thread_local RNG instance;
     return instance;
 }
 
 double RNG::getStandardNormal() {
+    PRICER_COUNT(Draws, 1);
     return normal_dist(generator);
+}
+
+template <typename Real, typename Distribution>
+void RNG::fillNormals(Real* out, std::size_t n, Distribution& dist) {
+
+    // 1. Draws, mirrored pairwise in antithetic mode
+    if (sampling.antithetic) {
+        std::size_t i = 0;
+        for (; i + 1 < n; i += 2) {
+            out[i] = dist(generator);
+            out[i + 1] = -out[i];
+        }
+        if (i < n) out[i] = dist(generator);
+    } else {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = dist(generator);
+        }
+    }
+
+    // 2. Moment matching: sample mean 0 and sample variance 1 over the buffer
+    // (moments in double whatever the precision of the buffer)
+    if (sampling.moment_matching && n >= 2) {
+        double sum = 0.0;
+        for (std::size_t i = 0; i < n; ++i) sum += out[i];
+        const double mean = sum / static_cast<double>(n);
+        double m2 = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            const double d = out[i] - mean;
+            m2 += d * d;
+        }
+        if (m2 > 0.0) {
+            const double scale = 1.0 / std::sqrt(m2 / static_cast<double>(n));
+            for (std::size_t i = 0; i < n; ++i) {
+                out[i] = static_cast<Real>((out[i] - mean) * scale);
+            }
+        }
+    }
+}
+
+void RNG::fillStandardNormal(double* out, std::size_t n) {
+    PRICER_TIME_SCOPE(RandomNumbers);
+    PRICER_COUNT(Draws, n);
+    fillNormals(out, n, normal_dist);
+}
+
+void RNG::fillStandardNormal(float* out, std::size_t n) {
+    PRICER_TIME_SCOPE(RandomNumbers);
+    PRICER_COUNT(Draws, n);
+    fillNormals(out, n, normal_dist_float);
+}
+
+double RNG::getUniform() {
+    PRICER_COUNT(Draws, 1);
+    double u;
+    do {
+        u = uniform_dist(generator);
+    } while (u <= 0.0);
+    return u;
+}
+
+void RNG::fillPoisson(double* out, std::size_t n, double mean) {
+
+    // 1. One normal per count, so that the SamplingScheme applies (antithetic normals
+    // give the uniforms u and 1 - u); draws are counted by fillStandardNormal()
+    fillStandardNormal(out, n);
+
+    // 2. Inversion of the CDF from u = Phi(z). Below Phi^-1(exp(-mean)) the count is 0,
+    // which spares the CDF evaluation for almost every draw when the mean is small
+    PRICER_TIME_SCOPE(RandomNumbers);
+    const double p0 = std::exp(-mean);
+    const double z0 = BlackScholesFormulas::N_inv(p0);
+    for (std::size_t i = 0; i < n; ++i) {
+        if (out[i] <= z0) {
+            out[i] = 0.0;
+            continue;
+        }
+        double u = BlackScholesFormulas::N_cdf(out[i]);
+        double k = 0.0;
+        double prob = p0;
+        double cdf = p0;
+        // Upper guard: cdf may stall just below 1 because of rounding
+        while (u > cdf && prob > 0.0) {
+            k += 1.0;
+            prob *= mean / k;
+            cdf += prob;
+        }
+        out[i] = k;
+    }
+}
+
+void RNG::seed(std::uint64_t seed, std::uint64_t stream) {
+    std::seed_seq sequence{
+        static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32),
+        static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32)
+    };
+    generator.seed(sequence);
+    // The normal distribution may cache a second value from the previous state
+    normal_dist.reset();
+    normal_dist_float.reset();
 }
\ No newline at end of file
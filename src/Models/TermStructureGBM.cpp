@@ -0,0 +1,101 @@
+#include "Models/TermStructureGBM.hpp"
+#include "Models/RNG.hpp"
+#include "Utils/Instrumentation.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+TermStructureGBM::TermStructureGBM(double S0_in, int steps_in, const Curve& rate_in, const Curve& vol_in,
+                                   double horizon_in)
+    : AssetModel(S0_in, steps_in), rate(rate_in), vol(vol_in)
+{
+    tables = buildTables(horizon_in);
+}
+
+TermStructureGBM::StepTables TermStructureGBM::buildTables(double T) const {
+    StepTables out;
+    out.horizon = T;
+    out.drift.resize(steps);
+    out.diffusion.resize(steps);
+
+    double dt = T / steps;
+    for (int i = 0; i < steps; ++i) {
+        double t0 = i * dt;
+        double t1 = (i + 1) * dt;
+        double variance = vol.integralOfSquare(t0, t1);
+        out.drift[i] = rate.integral(t0, t1) - 0.5 * variance;
+        out.diffusion[i] = std::sqrt(variance);
+    }
+    return out;
+}
+
+Path TermStructureGBM::generatePath(double T) const {
+
+    // 1. Step tables of the requested maturity (precomputed unless T differs)
+    StepTables local;
+    const StepTables* table = &tables;
+    if (T != tables.horizon) {
+        local = buildTables(T);
+        table = &local;
+    }
+
+    std::vector<double> prices_data;
+    prices_data.reserve(steps + 1);
+    prices_data.push_back(S0);
+
+    // 2. Exact update with the coefficients of each step
+    double current_price = S0;
+    for (int i = 0; i < steps; ++i) {
+        double Z = RNG::getInstance().getStandardNormal();
+        current_price *= std::exp(table->drift[i] + table->diffusion[i] * Z);
+        prices_data.push_back(current_price);
+    }
+
+    return Path(std::move(prices_data));
+}
+
+void TermStructureGBM::generatePathBatch(double T, PathBatch& batch) const {
+    PRICER_TIME_SCOPE(PathConstruction);
+
+    if (batch.getSteps() != steps || batch.getNumAssets() != 1) {
+        throw std::invalid_argument("Error: the PathBatch must have as many steps and assets as the model.");
+    }
+
+    // 1. Step tables of the requested maturity
+    StepTables local;
+    const StepTables* table = &tables;
+    if (T != tables.horizon) {
+        local = buildTables(T);
+        table = &local;
+    }
+
+    const std::size_t n = batch.getNumPaths();
+    double* Z = batch.getWorkspace(1);
+    RNG& rng = RNG::getInstance();
+
+    std::fill(batch.row(0), batch.row(0) + n, S0);
+
+    // 2. Same vectorizable row update as GBM, with the coefficients of step t
+    for (int t = 0; t < steps; ++t) {
+        rng.fillStandardNormal(Z, n);
+        const double drift_term = table->drift[t];
+        const double vol_term_factor = table->diffusion[t];
+        const double* current = batch.row(t);
+        double* next = batch.row(t + 1);
+        for (std::size_t p = 0; p < n; ++p) {
+            next[p] = current[p] * std::exp(drift_term + vol_term_factor * Z[p]);
+        }
+    }
+}
+
+double TermStructureGBM::getDiscountFactor(double T, double /*r*/) const {
+    return std::exp(-rate.integral(0.0, T));
+}
+
+std::vector<double> TermStructureGBM::getParameters() const {
+    std::vector<double> parameters = {S0, static_cast<double>(steps)};
+    rate.appendParameters(parameters);
+    vol.appendParameters(parameters);
+    return parameters;
+}
@@ -0,0 +1,34 @@
+#include "Options/BasketOption.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include "Core/Path.hpp"
+
+
+BasketOption::BasketOption(double T_in, double r_in, double K_in, const std::vector<double>& weights_in)
+    : EuropeanOption(T_in, r_in, K_in), weights(weights_in)
+{
+    if (weights.empty()) {
+        throw std::invalid_argument("Error: BasketOption requires at least one weight.");
+    }
+}
+
+
+double BasketOption::payoff(const Path& path) const {
+
+    if (path.getNumAssets() != weights.size()) {
+        throw std::invalid_argument("Error: the path must contain one asset per basket weight.");
+    }
+
+    double S_basket = 0.0;
+    for (std::size_t i = 0; i < weights.size(); ++i) {
+        S_basket += weights[i] * path.getFinalPrice(i);
+    }
+
+    return std::max(S_basket - K, 0.0);
+}
+
+std::vector<double> BasketOption::getParameters() const {
+    std::vector<double> parameters = {T, r, K};
+    parameters.insert(parameters.end(), weights.begin(), weights.end());
+    return parameters;
+}
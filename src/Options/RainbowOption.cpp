@@ -0,0 +1,19 @@
+#include "Options/RainbowOption.hpp"
+#include <algorithm>
+#include "Core/Path.hpp"
+
+
+RainbowOption::RainbowOption(double T_in, double r_in, double K_in, Type type_in)
+    : EuropeanOption(T_in, r_in, K_in), type(type_in) {}
+
+
+double RainbowOption::payoff(const Path& path) const {
+
+    double S_selected = path.getFinalPrice(0);
+    for (std::size_t i = 1; i < path.getNumAssets(); ++i) {
+        double S_i = path.getFinalPrice(i);
+        S_selected = (type == Type::BestOf) ? std::max(S_selected, S_i) : std::min(S_selected, S_i);
+    }
+
+    return std::max(S_selected - K, 0.0);
+}
@@ -0,0 +1,47 @@
+#include "PricingEngine/AsyncPricer.hpp"
+#include "PricingEngine/MonteCarloPricer.hpp"
+#include "PricingEngine/EDPSolver.hpp"
+
+AsyncPricer::AsyncPricer(PricingExecutor& executor_in)
+    : executor(executor_in)
+{}
+
+PricingJob<AdaptivePricingResult> AsyncPricer::submitMonteCarlo(const Option& option, const AssetModel& model,
+                                                                const AdaptiveSettings& settings,
+                                                                ProgressCallback on_progress) {
+    const Option* opt = &option;
+    const AssetModel* mdl = &model;
+
+    return launch<AdaptivePricingResult>([opt, mdl, settings](const ProgressCallback& observer) {
+        MonteCarloPricer pricer(*opt, *mdl);
+        AdaptivePricingResult result = pricer.calculatePriceAdaptive(settings, observer);
+        if (result.stop_reason == StopReason::Cancelled) {
+            throw PricingCancelled();
+        }
+        return result;
+    }, std::move(on_progress));
+}
+
+PricingJob<GreeksResult> AsyncPricer::submitGreeks(const Option& option, const AssetModel& model,
+                                                   int num_simulations, double epsilon,
+                                                   ProgressCallback on_progress) {
+    const Option* opt = &option;
+    const AssetModel* mdl = &model;
+
+    return launch<GreeksResult>([opt, mdl, num_simulations, epsilon](const ProgressCallback& observer) {
+        GreeksPricer greeks(*opt, *mdl);
+        return greeks.calculateDeltaGamma(num_simulations, epsilon, observer);
+    }, std::move(on_progress));
+}
+
+PricingJob<double> AsyncPricer::submitEDP(const Option& option, const GBM& model,
+                                          double S_max, int M, int N,
+                                          ProgressCallback on_progress) {
+    const Option* opt = &option;
+    const GBM* mdl = &model;
+
+    return launch<double>([opt, mdl, S_max, M, N](const ProgressCallback& observer) {
+        EDPSolver solver(*opt, *mdl);
+        return solver.solve(S_max, M, N, observer);
+    }, std::move(on_progress));
+}
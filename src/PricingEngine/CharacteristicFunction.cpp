@@ -0,0 +1,66 @@
+#include "PricingEngine/CharacteristicFunction.hpp"
+#include "Models/GBM.hpp"
+#include "Models/Heston.hpp"
+#include "Models/Merton.hpp"
+#include <cmath>
+
+namespace {
+    // Step of the numerical derivatives of log(phi) at the origin
+    const double CUMULANT_STEP = 1e-3;
+    const std::complex<double> I(0.0, 1.0);
+}
+
+void CharacteristicFunction::cumulants(double T, double& c1, double& c2) const {
+    // log phi(u) = i*u*c1 - u^2*c2/2 + O(u^3): central differences
+    const double h = CUMULANT_STEP;
+    std::complex<double> plus = std::log((*this)(std::complex<double>(h, 0.0), T));
+    std::complex<double> minus = std::log((*this)(std::complex<double>(-h, 0.0), T));
+    c1 = (plus - minus).imag() / (2.0 * h);
+    c2 = -(plus + minus).real() / (h * h);
+}
+
+std::unique_ptr<CharacteristicFunction> CharacteristicFunction::fromModel(const AssetModel& model) {
+    if (const GBM* gbm = dynamic_cast<const GBM*>(&model)) {
+        return std::make_unique<GBMCharacteristicFunction>(gbm->getMu(), gbm->getSigma());
+    }
+    if (const Heston* heston = dynamic_cast<const Heston*>(&model)) {
+        return std::make_unique<HestonCharacteristicFunction>(heston->getMu(), heston->getV0(), heston->getKappa(),
+                                                              heston->getTheta(), heston->getXi(), heston->getRho());
+    }
+    if (const Merton* merton = dynamic_cast<const Merton*>(&model)) {
+        return std::make_unique<MertonCharacteristicFunction>(merton->getMu(), merton->getSigma(), merton->getLambda(),
+                                                              merton->getJumpMean(), merton->getJumpVol());
+    }
+    return nullptr;
+}
+
+std::complex<double> GBMCharacteristicFunction::operator()(std::complex<double> u, double T) const {
+    return std::exp(I * u * ((r - 0.5 * sigma * sigma) * T) - 0.5 * sigma * sigma * T * u * u);
+}
+
+void GBMCharacteristicFunction::cumulants(double T, double& c1, double& c2) const {
+    c1 = (r - 0.5 * sigma * sigma) * T;
+    c2 = sigma * sigma * T;
+}
+
+std::complex<double> HestonCharacteristicFunction::operator()(std::complex<double> u, double T) const {
+    const double xi2 = xi * xi;
+    std::complex<double> beta = kappa - rho * xi * I * u;
+    std::complex<double> d = std::sqrt(beta * beta + xi2 * (I * u + u * u));
+    std::complex<double> g = (beta - d) / (beta + d);
+    std::complex<double> e = std::exp(-d * T);
+
+    std::complex<double> C = I * u * (r * T)
+        + (kappa * theta / xi2) * ((beta - d) * T - 2.0 * std::log((1.0 - g * e) / (1.0 - g)));
+    std::complex<double> D = ((beta - d) / xi2) * (1.0 - e) / (1.0 - g * e);
+
+    return std::exp(C + D * v0);
+}
+
+std::complex<double> MertonCharacteristicFunction::operator()(std::complex<double> u, double T) const {
+    const double k = std::exp(jump_mean + 0.5 * jump_vol * jump_vol) - 1.0;
+    std::complex<double> diffusion = I * u * ((r - 0.5 * sigma * sigma - lambda * k) * T)
+                                   - 0.5 * sigma * sigma * T * u * u;
+    std::complex<double> jumps = lambda * T * (std::exp(I * u * jump_mean - 0.5 * jump_vol * jump_vol * u * u) - 1.0);
+    return std::exp(diffusion + jumps);
+}
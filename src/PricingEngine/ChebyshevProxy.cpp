@@ -0,0 +1,317 @@
+#include "PricingEngine/ChebyshevProxy.hpp"
+#include "PricingEngine/PricingExecutor.hpp"
+#include "Utils/BinaryIO.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <random>
+#include <stdexcept>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace {
+
+    // "CHEB" tag followed by the format version
+    const std::uint32_t PROXY_MAGIC = 0x42454843;
+    const std::uint32_t PROXY_VERSION = 1;
+
+    /**
+     * @brief Chebyshev-Lobatto node k of n, mapped to [lower, upper].
+     */
+    double node(const ChebyshevAxis& axis, int k) {
+        double x = std::cos(M_PI * k / axis.degree);
+        return axis.lower + 0.5 * (x + 1.0) * (axis.upper - axis.lower);
+    }
+
+    void checkAxes(const std::vector<ChebyshevAxis>& axes) {
+        if (axes.empty() || axes.size() > ChebyshevProxy::MAX_DIMENSIONS) {
+            throw std::invalid_argument("Error: a Chebyshev proxy has 1 to 3 axes.");
+        }
+        for (const ChebyshevAxis& axis : axes) {
+            if (!(axis.upper > axis.lower) || axis.degree < 1 || axis.degree > ChebyshevProxy::MAX_DEGREE) {
+                throw std::invalid_argument("Error: invalid Chebyshev axis (lower < upper, 1 <= degree <= 64).");
+            }
+        }
+    }
+}
+
+ChebyshevProxy ChebyshevProxy::build(const std::function<double(const std::vector<double>&)>& function,
+                                     const std::vector<ChebyshevAxis>& axes,
+                                     PricingExecutor* executor)
+{
+    checkAxes(axes);
+
+    ChebyshevProxy proxy;
+    proxy.axes = axes;
+
+    const std::size_t dims = axes.size();
+    std::vector<std::size_t> sizes(dims);
+    std::size_t total = 1;
+    for (std::size_t d = 0; d < dims; ++d) {
+        sizes[d] = static_cast<std::size_t>(axes[d].degree) + 1;
+        total *= sizes[d];
+    }
+
+    // 1. Node coordinates of a flat (row-major) index
+    auto coordinates = [&](std::size_t flat) {
+        std::vector<double> point(dims);
+        for (std::size_t d = dims; d-- > 0;) {
+            point[d] = node(axes[d], static_cast<int>(flat % sizes[d]));
+            flat /= sizes[d];
+        }
+        return point;
+    };
+
+    // 2. Sample the engine on every node (concurrently if an executor is given, inline
+    // when build() itself runs on one of its workers, which could otherwise deadlock)
+    std::vector<double> values(total);
+    if (executor && !executor->isWorkerThread()) {
+        std::vector<std::future<double>> pending;
+        pending.reserve(total);
+        for (std::size_t i = 0; i < total; ++i) {
+            auto task = std::make_shared<std::packaged_task<double()>>(
+                [&function, point = coordinates(i)]() { return function(point); });
+            pending.push_back(task->get_future());
+            executor->submit([task]() { (*task)(); });
+        }
+        // Every task references function: all must be finished before an error is rethrown
+        for (std::future<double>& future : pending) {
+            future.wait();
+        }
+        for (std::size_t i = 0; i < total; ++i) {
+            values[i] = pending[i].get();
+        }
+    } else {
+        for (std::size_t i = 0; i < total; ++i) {
+            values[i] = function(coordinates(i));
+        }
+    }
+
+    // 3. Discrete cosine transform (type I) along each axis in turn
+    for (std::size_t d = 0; d < dims; ++d) {
+        const int n = axes[d].degree;
+        std::size_t stride = 1;
+        for (std::size_t e = d + 1; e < dims; ++e) stride *= sizes[e];
+        const std::size_t block = sizes[d] * stride;
+
+        std::vector<double> line(n + 1), transformed(n + 1);
+        for (std::size_t start = 0; start < total; start += block) {
+            for (std::size_t offset = 0; offset < stride; ++offset) {
+                for (int k = 0; k <= n; ++k) {
+                    line[k] = values[start + offset + k * stride];
+                }
+                for (int j = 0; j <= n; ++j) {
+                    double sum = 0.0;
+                    for (int k = 0; k <= n; ++k) {
+                        double w = (k == 0 || k == n) ? 0.5 : 1.0;
+                        sum += w * line[k] * std::cos(M_PI * j * k / n);
+                    }
+                    double c = 2.0 * sum / n;
+                    transformed[j] = (j == 0 || j == n) ? 0.5 * c : c;
+                }
+                for (int j = 0; j <= n; ++j) {
+                    values[start + offset + j * stride] = transformed[j];
+                }
+            }
+        }
+    }
+    proxy.coefficients = values;
+
+    // 4. Error estimate: coefficients in the last two layers of any axis
+    for (std::size_t i = 0; i < total; ++i) {
+        std::size_t flat = i;
+        bool tail = false;
+        for (std::size_t d = dims; d-- > 0;) {
+            int index = static_cast<int>(flat % sizes[d]);
+            flat /= sizes[d];
+            if (index >= axes[d].degree - 1 && axes[d].degree > 1) tail = true;
+        }
+        if (tail) proxy.error_estimate += std::abs(proxy.coefficients[i]);
+    }
+
+    return proxy;
+}
+
+double ChebyshevProxy::contract(const double* point, const int* orders) const {
+
+    // 1. Basis values T_k, T'_k or T''_k of every axis (stack buffers, no allocation).
+    //    The axes are aligned on the last slots so that the innermost loop is never trivial.
+    double basis[MAX_DIMENSIONS][MAX_DEGREE + 1];
+    std::size_t sizes[MAX_DIMENSIONS] = {1, 1, 1};
+    const std::size_t first_slot = MAX_DIMENSIONS - axes.size();
+    double scale = 1.0;
+
+    for (std::size_t slot = 0; slot < first_slot; ++slot) {
+        basis[slot][0] = 1.0;
+    }
+
+    for (std::size_t d = 0; d < axes.size(); ++d) {
+        const ChebyshevAxis& axis = axes[d];
+        if (point[d] < axis.lower || point[d] > axis.upper) {
+            throw std::out_of_range("Error: point outside the domain of the Chebyshev proxy.");
+        }
+        const int n = axis.degree;
+        const double half_width_inv = 2.0 / (axis.upper - axis.lower);
+        const double t = (point[d] - axis.lower) * half_width_inv - 1.0;
+        double* out = basis[first_slot + d];
+        sizes[first_slot + d] = static_cast<std::size_t>(n) + 1;
+
+        // T_{k+1} = 2t T_k - T_{k-1}
+        double T_prev = 1.0, T_curr = t;
+        if (orders[d] == 0) {
+            out[0] = 1.0;
+            out[1] = t;
+            for (int k = 1; k < n; ++k) {
+                out[k + 1] = 2.0 * t * out[k] - out[k - 1];
+            }
+            continue;
+        }
+
+        // T'_{k+1} = 2T_k + 2t T'_k - T'_{k-1}, T''_{k+1} = 4T'_k + 2t T''_k - T''_{k-1}
+        double D_prev = 0.0, D_curr = 1.0, E_prev = 0.0, E_curr = 0.0;
+        out[0] = 0.0;
+        out[1] = (orders[d] == 1) ? D_curr : E_curr;
+        for (int k = 1; k < n; ++k) {
+            double T_next = 2.0 * t * T_curr - T_prev;
+            double D_next = 2.0 * T_curr + 2.0 * t * D_curr - D_prev;
+            double E_next = 4.0 * D_curr + 2.0 * t * E_curr - E_prev;
+            T_prev = T_curr; T_curr = T_next;
+            D_prev = D_curr; D_curr = D_next;
+            E_prev = E_curr; E_curr = E_next;
+            out[k + 1] = (orders[d] == 1) ? D_curr : E_curr;
+        }
+        scale *= (orders[d] == 1) ? half_width_inv : half_width_inv * half_width_inv;
+    }
+
+    // 2. Tensor contraction, last axis innermost (contiguous coefficients)
+    const double* c = coefficients.data();
+    double total = 0.0;
+    for (std::size_t i = 0; i < sizes[0]; ++i) {
+        double partial_i = 0.0;
+        for (std::size_t j = 0; j < sizes[1]; ++j) {
+            const double* row = c + (i * sizes[1] + j) * sizes[2];
+            double partial_j = 0.0;
+            for (std::size_t k = 0; k < sizes[2]; ++k) {
+                partial_j += row[k] * basis[2][k];
+            }
+            partial_i += partial_j * basis[1][j];
+        }
+        total += partial_i * basis[0][i];
+    }
+    return scale * total;
+}
+
+double ChebyshevProxy::evaluate(const double* point) const {
+    const int zeros[MAX_DIMENSIONS] = {0, 0, 0};
+    return contract(point, zeros);
+}
+
+double ChebyshevProxy::derivative(const double* point, const int* orders) const {
+    int padded[MAX_DIMENSIONS] = {0, 0, 0};
+    for (std::size_t d = 0; d < axes.size(); ++d) {
+        if (orders[d] < 0 || orders[d] > 2) {
+            throw std::invalid_argument("Error: Chebyshev proxy derivatives are of order 0, 1 or 2.");
+        }
+        padded[d] = orders[d];
+    }
+    return contract(point, padded);
+}
+
+double ChebyshevProxy::derivative(const std::vector<double>& point, const std::vector<int>& orders) const {
+    if (point.size() != axes.size() || orders.size() != axes.size()) {
+        throw std::invalid_argument("Error: one coordinate and one order per axis are required.");
+    }
+    return derivative(point.data(), orders.data());
+}
+
+double ChebyshevProxy::measureError(const std::function<double(const std::vector<double>&)>& function,
+                                    int num_points) const
+{
+    std::mt19937 generator(12345);
+    std::vector<double> point(axes.size());
+    double max_error = 0.0;
+
+    for (int i = 0; i < num_points; ++i) {
+        for (std::size_t d = 0; d < axes.size(); ++d) {
+            std::uniform_real_distribution<double> uniform(axes[d].lower, axes[d].upper);
+            point[d] = uniform(generator);
+        }
+        max_error = std::max(max_error, std::abs(evaluate(point) - function(point)));
+    }
+    return max_error;
+}
+
+void ChebyshevProxy::writeBinary(std::ostream& os) const {
+    BinaryIO::writeU32(os, PROXY_MAGIC);
+    BinaryIO::writeU32(os, PROXY_VERSION);
+    BinaryIO::writeU32(os, static_cast<std::uint32_t>(axes.size()));
+    for (const ChebyshevAxis& axis : axes) {
+        BinaryIO::writeDouble(os, axis.lower);
+        BinaryIO::writeDouble(os, axis.upper);
+        BinaryIO::writeU32(os, static_cast<std::uint32_t>(axis.degree));
+    }
+    BinaryIO::writeDouble(os, error_estimate);
+    BinaryIO::writeU64(os, coefficients.size());
+    for (double c : coefficients) {
+        BinaryIO::writeDouble(os, c);
+    }
+}
+
+ChebyshevProxy ChebyshevProxy::readBinary(std::istream& is) {
+    if (BinaryIO::readU32(is) != PROXY_MAGIC) {
+        throw std::runtime_error("Error: not a serialized ChebyshevProxy.");
+    }
+    if (BinaryIO::readU32(is) != PROXY_VERSION) {
+        throw std::runtime_error("Error: unsupported ChebyshevProxy format version.");
+    }
+
+    ChebyshevProxy proxy;
+    std::uint32_t dims = BinaryIO::readU32(is);
+    std::size_t expected = 1;
+    for (std::uint32_t d = 0; d < dims && d < MAX_DIMENSIONS + 1; ++d) {
+        ChebyshevAxis axis;
+        axis.lower = BinaryIO::readDouble(is);
+        axis.upper = BinaryIO::readDouble(is);
+        axis.degree = static_cast<int>(BinaryIO::readU32(is));
+        proxy.axes.push_back(axis);
+        expected *= static_cast<std::size_t>(axis.degree) + 1;
+    }
+    try {
+        checkAxes(proxy.axes);
+    } catch (const std::invalid_argument& e) {
+        throw std::runtime_error(e.what());
+    }
+
+    proxy.error_estimate = BinaryIO::readDouble(is);
+    if (BinaryIO::readU64(is) != expected) {
+        throw std::runtime_error("Error: ChebyshevProxy coefficient count does not match its axes.");
+    }
+    proxy.coefficients.resize(expected);
+    for (double& c : proxy.coefficients) {
+        c = BinaryIO::readDouble(is);
+    }
+    return proxy;
+}
+
+void ChebyshevProxy::save(const std::string& filename) const {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw std::runtime_error("Error: cannot open proxy file " + filename);
+    }
+    writeBinary(file);
+    if (!file) {
+        throw std::runtime_error("Error: failed to write proxy file " + filename);
+    }
+}
+
+ChebyshevProxy ChebyshevProxy::load(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Error: cannot open proxy file " + filename);
+    }
+    return readBinary(file);
+}
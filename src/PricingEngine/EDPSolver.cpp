@@ -7,7 +7,8 @@ EDPSolver::EDPSolver(const Option& option_in, const GBM& model_in)
     : option(option_in), model(model_in) {}
 
 // LA METHODE DE CALCUL DE COURBE
-std::pair<std::vector<double>, std::vector<double>> EDPSolver::calculateEDPCurve(double S_max, int M, int N) const {
+std::pair<std::vector<double>, std::vector<double>> EDPSolver::calculateEDPCurve(double S_max, int M, int N,
+                                                                                const ProgressCallback& on_progress) const {
     
     double T = option.getT(); // Assure-toi que c'est getExpiry() ou getT() selon ton Option.hpp
     double r = model.getMu();
@@ -26,6 +27,10 @@ std::pair<std::vector<double>, std::vector<double>> EDPSolver::calculateEDPCurve
         V[i] = option.payoff(p);
     }
 
+    // Fréquence des rapports de progression et noeud de S0
+    int report_every = std::max(1, N / 100);
+    int s0_index = std::min(M, std::max(0, static_cast<int>(std::round(model.getS0() / dS))));
+
     // 2. Boucle temporelle (Remontée de T vers 0)
     for (int j = N - 1; j >= 0; --j) {
         std::vector<double> V_next(M + 1);
@@ -49,14 +54,24 @@ std::pair<std::vector<double>, std::vector<double>> EDPSolver::calculateEDPCurve
         V_next[M] = V[M]; 
         
         V = V_next;
+
+        // 4. Progression (prix courant au noeud le plus proche de S0)
+        if (on_progress && (j % report_every == 0)) {
+            PricingProgress progress;
+            progress.fraction = static_cast<double>(N - j) / N;
+            progress.price = V[s0_index];
+            if (!on_progress(progress)) {
+                throw PricingCancelled();
+            }
+        }
     }
 
     return {S_vec, V};
 }
 
 // METHODE SOLVE (Pour obtenir le prix unique à S0)
-double EDPSolver::solve(double S_max, int M, int N) const {
-    auto curve = calculateEDPCurve(S_max, M, N);
+double EDPSolver::solve(double S_max, int M, int N, const ProgressCallback& on_progress) const {
+    auto curve = calculateEDPCurve(S_max, M, N, on_progress);
     double dS = S_max / M;
     
     // Trouver l'index correspondant au prix S0 actuel
@@ -0,0 +1,159 @@
+#include "PricingEngine/FourierPricer.hpp"
+#include "Models/AssetModel.hpp"
+#include "Options/EuropeanCall.hpp"
+#include "Options/EuropeanPut.hpp"
+#include "Utils/FFT.hpp"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+FourierPricer::FourierPricer(const AssetModel& model)
+    : cf(CharacteristicFunction::fromModel(model)), S0(model.getS0())
+{
+    if (!cf) {
+        throw std::invalid_argument("Error: FourierPricer requires a model with a characteristic function (GBM, Heston, Merton).");
+    }
+}
+
+FourierPricer::FourierPricer(std::shared_ptr<const CharacteristicFunction> cf_in, double S0_in)
+    : cf(std::move(cf_in)), S0(S0_in)
+{
+    if (!cf) {
+        throw std::invalid_argument("Error: FourierPricer requires a characteristic function.");
+    }
+}
+
+std::vector<double> FourierPricer::priceCOS(const std::vector<double>& strikes, double T, double r, bool is_call,
+                                            int num_terms, double truncation) const
+{
+    std::vector<double> prices(strikes.size());
+    if (strikes.empty()) return prices;
+
+    // 1. Truncation interval of y = ln(S_T / K) = x + ln(S_T / S0), x = ln(S0 / K), for every strike
+    double c1, c2;
+    cf->cumulants(T, c1, c2);
+    double x_min = HUGE_VAL, x_max = -HUGE_VAL;
+    for (double K : strikes) {
+        double x = std::log(S0 / K);
+        x_min = std::min(x_min, x);
+        x_max = std::max(x_max, x);
+    }
+    const double half_width = truncation * std::sqrt(c2);
+    const double a = std::min(x_min + c1 - half_width, -1e-3);
+    const double b = std::max(x_max + c1 + half_width, 1e-3);
+    const double width = b - a;
+
+    // 2. Strike-independent terms: phi(u_k) times the put payoff coefficients U_k on [a, 0]
+    std::vector<double> coeff_re(num_terms), coeff_im(num_terms);
+    for (int k = 0; k < num_terms; ++k) {
+        double u = k * M_PI / width;
+        std::complex<double> phi = (*cf)(std::complex<double>(u, 0.0), T);
+
+        // chi_k(a, 0) = int_a^0 e^y cos(u(y-a)) dy, psi_k(a, 0) = int_a^0 cos(u(y-a)) dy
+        double chi = (std::cos(-u * a) - std::exp(a) + u * std::sin(-u * a)) / (1.0 + u * u);
+        double psi = (k == 0) ? -a : std::sin(-u * a) / u;
+        double U = 2.0 / width * (psi - chi);
+        if (k == 0) U *= 0.5;   // first term of the cosine series has weight 1/2
+
+        coeff_re[k] = phi.real() * U;
+        coeff_im[k] = phi.imag() * U;
+    }
+
+    // 3. N-term sum for every strike; exp(i u_k (x - a)) is advanced by a per-strike rotation.
+    //    The strike loop is innermost: independent recurrences that the compiler vectorizes
+    //    (plain real arithmetic, std::complex products are not inlined without -ffast-math).
+    const std::size_t num_strikes = strikes.size();
+    std::vector<double> rot_re(num_strikes), rot_im(num_strikes);
+    std::vector<double> w_re(num_strikes, 1.0), w_im(num_strikes, 0.0);
+    std::vector<double> sum(num_strikes, 0.0);
+    for (std::size_t s = 0; s < num_strikes; ++s) {
+        const double angle = M_PI * (std::log(S0 / strikes[s]) - a) / width;
+        rot_re[s] = std::cos(angle);
+        rot_im[s] = std::sin(angle);
+    }
+
+    for (int k = 0; k < num_terms; ++k) {
+        const double c_re = coeff_re[k];
+        const double c_im = coeff_im[k];
+        for (std::size_t s = 0; s < num_strikes; ++s) {
+            sum[s] += c_re * w_re[s] - c_im * w_im[s];
+            double next_re = w_re[s] * rot_re[s] - w_im[s] * rot_im[s];
+            w_im[s] = w_re[s] * rot_im[s] + w_im[s] * rot_re[s];
+            w_re[s] = next_re;
+        }
+    }
+
+    // 4. Discounting, calls by put-call parity
+    const double df = std::exp(-r * T);
+    for (std::size_t s = 0; s < num_strikes; ++s) {
+        const double K = strikes[s];
+        double put = std::max(K * df * sum[s], 0.0);
+        prices[s] = is_call ? std::max(put + S0 - K * df, 0.0) : put;
+    }
+    return prices;
+}
+
+std::vector<double> FourierPricer::priceCallsFFT(const std::vector<double>& strikes, double T, double r,
+                                                 int fft_size, double eta, double alpha) const
+{
+    // 1. Log-strike grid centred on ln(S0): k_j = ln(S0) - half_range + lambda * j
+    const double lambda = 2.0 * M_PI / (fft_size * eta);
+    const double half_range = 0.5 * fft_size * lambda;
+    const double log_S0 = std::log(S0);
+    const double k_start = log_S0 - half_range;
+    const double df = std::exp(-r * T);
+    const std::complex<double> I(0.0, 1.0);
+
+    // 2. Damped transform of the call price sampled at v_j = eta * j, Simpson weights
+    std::vector<std::complex<double>> data(fft_size);
+    for (int j = 0; j < fft_size; ++j) {
+        double v = eta * j;
+        std::complex<double> u(v, -(alpha + 1.0));
+        // Characteristic function of ln(S_T) = ln(S0) + X_T
+        std::complex<double> phi = std::exp(I * u * log_S0) * (*cf)(u, T);
+        std::complex<double> psi = df * phi / std::complex<double>(alpha * alpha + alpha - v * v, (2.0 * alpha + 1.0) * v);
+
+        double simpson = (j == 0) ? 1.0 / 3.0 : ((j % 2 == 1) ? 4.0 / 3.0 : 2.0 / 3.0);
+        data[j] = std::exp(-I * (v * k_start)) * psi * (eta * simpson);
+    }
+
+    // 3. One transform for the whole grid
+    FFT::forward(data);
+
+    // 4. Undamp and interpolate linearly in log-strike
+    std::vector<double> prices(strikes.size());
+    for (std::size_t s = 0; s < strikes.size(); ++s) {
+        double k = std::log(strikes[s]);
+        double position = (k - k_start) / lambda;
+        if (position < 0.0 || position >= fft_size - 1) {
+            throw std::invalid_argument("Error: strike outside the FFT log-strike grid.");
+        }
+        int j = static_cast<int>(position);
+        double w = position - j;
+        double c_low = std::exp(-alpha * (k_start + lambda * j)) / M_PI * data[j].real();
+        double c_high = std::exp(-alpha * (k_start + lambda * (j + 1))) / M_PI * data[j + 1].real();
+        prices[s] = std::max((1.0 - w) * c_low + w * c_high, 0.0);
+    }
+    return prices;
+}
+
+double FourierPricer::price(const Option& option) const {
+    if (const EuropeanCall* call = dynamic_cast<const EuropeanCall*>(&option)) {
+        return priceCOS({call->getK()}, option.getT(), option.getR(), true).front();
+    }
+    if (const EuropeanPut* put = dynamic_cast<const EuropeanPut*>(&option)) {
+        return priceCOS({put->getK()}, option.getT(), option.getR(), false).front();
+    }
+    throw std::invalid_argument("Error: FourierPricer only prices European calls and puts.");
+}
+
+bool FourierPricer::supports(const Option& option, const AssetModel& model) {
+    bool vanilla = dynamic_cast<const EuropeanCall*>(&option) != nullptr
+                || dynamic_cast<const EuropeanPut*>(&option) != nullptr;
+    return vanilla && CharacteristicFunction::fromModel(model) != nullptr;
+}
@@ -4,12 +4,14 @@
 #include <iostream>
 #include <stdexcept>
 #include <cmath>
+#include <algorithm>
 
 GreeksPricer::GreeksPricer(const Option& option_in, const AssetModel& model_in)
     : option(option_in), model(model_in)
 {}
 
-double GreeksPricer::getPriceAtS(double S_new, int num_simulations) const {
+double GreeksPricer::getPriceAtS(double S_new, int num_simulations,
+                                 const ProgressCallback& on_progress) const {
     
     // La méthode 'dynamic_cast' est utilisée pour accéder aux paramètres spécifiques
     // d'un modèle concret (GBM) à partir de son interface (AssetModel).
@@ -24,7 +26,19 @@ double GreeksPricer::getPriceAtS(double S_new, int num_simulations) const {
         MonteCarloPricer temp_pricer(option, new_gbm);
         
         // 3. Calcule et retourne le prix
-        return temp_pricer.calculatePrice(num_simulations).price;
+        if (!on_progress) {
+            return temp_pricer.calculatePrice(num_simulations).price;
+        }
+
+        // Avec observateur : exécution par lots pour remonter la progression
+        AdaptiveSettings settings;
+        settings.max_paths = num_simulations;
+        settings.batch_size = std::max(1000, num_simulations / 20);
+        AdaptivePricingResult res = temp_pricer.calculatePriceAdaptive(settings, on_progress);
+        if (res.stop_reason == StopReason::Cancelled) {
+            throw PricingCancelled();
+        }
+        return res.price;
         
     } catch (const std::bad_cast& e) {
         std::cerr << "Erreur: GreeksPricer (getPriceAtS) nécessite actuellement une instance de modèle GBM pour la perturbation de S0.\n";
@@ -74,4 +88,32 @@ double GreeksPricer::calculateGamma(int num_simulations, double epsilon) const {
     double gamma = (V_plus - 2.0 * V_base + V_minus) / (epsilon * epsilon);
     
     return gamma;
+}
+
+GreeksResult GreeksPricer::calculateDeltaGamma(int num_simulations, double epsilon,
+                                               const ProgressCallback& on_progress) const {
+
+    double S0_base = model.getS0();
+    double bumps[3] = {S0_base - epsilon, S0_base, S0_base + epsilon};
+    double values[3];
+
+    // 1. Trois pricings : V(S - eps), V(S), V(S + eps)
+    for (int k = 0; k < 3; ++k) {
+        ProgressCallback bump_progress;
+        if (on_progress) {
+            // La progression de chaque pricing couvre un tiers du travail total
+            bump_progress = [&on_progress, k](const PricingProgress& p) {
+                PricingProgress overall = p;
+                overall.fraction = (k + p.fraction) / 3.0;
+                return on_progress(overall);
+            };
+        }
+        values[k] = getPriceAtS(bumps[k], num_simulations, bump_progress);
+    }
+
+    // 2. Différences finies centrées
+    GreeksResult result;
+    result.delta = (values[2] - values[0]) / (2.0 * epsilon);
+    result.gamma = (values[2] - 2.0 * values[1] + values[0]) / (epsilon * epsilon);
+    return result;
 }
\ No newline at end of file
@@ -0,0 +1,207 @@
+#include "PricingEngine/LatticePricer.hpp"
+#include "Options/EuropeanOption.hpp"
+#include "Utils/BlackScholesFormulas.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+    /**
+     * @brief Peizer-Pratt inversion (method 2) used by Leisen-Reimer: binomial probability for z.
+     */
+    double peizerPratt(double z, int n) {
+        double a = z / (n + 1.0 / 3.0 + 0.1 / (n + 1.0));
+        double sign = (z >= 0.0) ? 1.0 : -1.0;
+        return 0.5 + sign * 0.5 * std::sqrt(1.0 - std::exp(-a * a * (n + 1.0 / 6.0)));
+    }
+
+    /**
+     * @brief Steps at which early exercise is allowed (maturity is handled separately).
+     */
+    std::vector<char> exerciseSteps(const LatticeSettings& settings, int steps, double T) {
+        std::vector<char> allowed(steps, 0);
+        if (settings.exercise == ExerciseStyle::American) {
+            std::fill(allowed.begin(), allowed.end(), 1);
+        } else if (settings.exercise == ExerciseStyle::Bermudan) {
+            for (double t : settings.exercise_times) {
+                if (t < 0.0 || t >= T) continue;
+                int i = static_cast<int>(std::lround(t / T * steps));
+                if (i < steps) allowed[i] = 1;
+            }
+        }
+        return allowed;
+    }
+
+    /**
+     * @brief One backward induction for every lane of the ladder.
+     */
+    std::vector<double> induct(const std::vector<const Option*>& options, const GBM& model,
+                               int steps, const LatticeSettings& settings)
+    {
+        const std::size_t L = options.size();
+        const double T = options.front()->getT();
+        const double r = options.front()->getR();
+        const double S0 = model.getS0();
+        const double sigma = model.getSigma();
+        const double dt = T / steps;
+        const double df = std::exp(-r * dt);
+        const std::vector<char> allowed = exerciseSteps(settings, steps, T);
+
+        // Exercise value through the Option hierarchy (one-point path, reused)
+        Path point({S0});
+        auto exerciseValue = [&point](const Option& opt, double S) {
+            point.data()[0] = S;
+            return opt.payoff(point);
+        };
+
+        // --- Trinomial tree: node j of step i has price S0 * u^(j - i) ---
+        if (settings.type == LatticeType::Trinomial) {
+            const double u = std::exp(sigma * std::sqrt(2.0 * dt));
+            const double a = std::exp(0.5 * r * dt);
+            const double up = std::exp(sigma * std::sqrt(0.5 * dt));
+            const double down = 1.0 / up;
+            const double pu = df * std::pow((a - down) / (up - down), 2);
+            const double pd = df * std::pow((up - a) / (up - down), 2);
+            const double pm = df - pu - pd;
+
+            // 1. Terminal layer (2N+1 nodes, lanes contiguous)
+            std::vector<double> V((2 * steps + 1) * L);
+            for (int j = 0; j <= 2 * steps; ++j) {
+                double S = S0 * std::pow(u, j - steps);
+                for (std::size_t l = 0; l < L; ++l) {
+                    V[j * L + l] = exerciseValue(*options[l], S);
+                }
+            }
+
+            // 2. Rolling induction: node j reads j, j+1, j+2 of the next step (bottom-up in place)
+            for (int i = steps - 1; i >= 0; --i) {
+                for (int j = 0; j <= 2 * i; ++j) {
+                    double* out = V.data() + j * L;
+                    const double* mid = out + L;
+                    const double* high = out + 2 * L;
+                    for (std::size_t l = 0; l < L; ++l) {
+                        out[l] = pd * out[l] + pm * mid[l] + pu * high[l];
+                    }
+                }
+                if (allowed[i]) {
+                    for (int j = 0; j <= 2 * i; ++j) {
+                        double S = S0 * std::pow(u, j - i);
+                        for (std::size_t l = 0; l < L; ++l) {
+                            V[j * L + l] = std::max(V[j * L + l], exerciseValue(*options[l], S));
+                        }
+                    }
+                }
+            }
+            return std::vector<double>(V.begin(), V.begin() + L);
+        }
+
+        // --- Binomial trees: node j of step i has price S0 * u^j * d^(i - j), per lane ---
+        std::vector<double> u(L), d(L), pu(L), pd(L);
+        for (std::size_t l = 0; l < L; ++l) {
+            if (settings.type == LatticeType::CRR) {
+                u[l] = std::exp(sigma * std::sqrt(dt));
+                d[l] = 1.0 / u[l];
+                double p = (std::exp(r * dt) - d[l]) / (u[l] - d[l]);
+                pu[l] = df * p;
+                pd[l] = df * (1.0 - p);
+            } else {
+                // Leisen-Reimer: the tree is centred on the strike of the lane
+                const EuropeanOption* european = dynamic_cast<const EuropeanOption*>(options[l]);
+                double K = european ? european->getK() : S0;
+                double d1, d2;
+                BlackScholesFormulas::calculate_d1_d2(S0, K, T, r, sigma, d1, d2);
+                double p = peizerPratt(d2, steps);
+                double p_star = peizerPratt(d1, steps);
+                u[l] = std::exp(r * dt) * p_star / p;
+                d[l] = (std::exp(r * dt) - p * u[l]) / (1.0 - p);
+                pu[l] = df * p;
+                pd[l] = df * (1.0 - p);
+            }
+        }
+
+        // 1. Terminal layer (N+1 nodes, lanes contiguous)
+        std::vector<double> V((steps + 1) * L);
+        for (std::size_t l = 0; l < L; ++l) {
+            double S = S0 * std::pow(d[l], steps);
+            const double ratio = u[l] / d[l];
+            for (int j = 0; j <= steps; ++j) {
+                V[j * L + l] = exerciseValue(*options[l], S);
+                S *= ratio;
+            }
+        }
+
+        // 2. Rolling induction: node j reads j and j+1 of the next step (bottom-up in place)
+        for (int i = steps - 1; i >= 0; --i) {
+            for (int j = 0; j <= i; ++j) {
+                double* out = V.data() + j * L;
+                const double* high = out + L;
+                for (std::size_t l = 0; l < L; ++l) {
+                    out[l] = pd[l] * out[l] + pu[l] * high[l];
+                }
+            }
+            if (allowed[i]) {
+                for (std::size_t l = 0; l < L; ++l) {
+                    double S = S0 * std::pow(d[l], i);
+                    const double ratio = u[l] / d[l];
+                    for (int j = 0; j <= i; ++j) {
+                        V[j * L + l] = std::max(V[j * L + l], exerciseValue(*options[l], S));
+                        S *= ratio;
+                    }
+                }
+            }
+        }
+        return std::vector<double>(V.begin(), V.begin() + L);
+    }
+
+    /**
+     * @brief Leisen-Reimer needs an odd number of steps.
+     */
+    int adjustSteps(int steps, LatticeType type) {
+        return (type == LatticeType::LeisenReimer && steps % 2 == 0) ? steps + 1 : steps;
+    }
+}
+
+LatticePricer::LatticePricer(const Option& option_in, const GBM& model_in)
+    : option(option_in), model(model_in) {}
+
+double LatticePricer::calculatePrice(int steps, const LatticeSettings& settings) const {
+    return calculateLadder({&option}, model, steps, settings).front();
+}
+
+std::vector<double> LatticePricer::calculateLadder(const std::vector<const Option*>& options, const GBM& model,
+                                                   int steps, const LatticeSettings& settings)
+{
+    if (options.empty()) return {};
+    if (steps < 2) {
+        throw std::invalid_argument("Error: a lattice requires at least 2 time steps.");
+    }
+    for (const Option* opt : options) {
+        if (opt->getT() != options.front()->getT() || opt->getR() != options.front()->getR()) {
+            throw std::invalid_argument("Error: the options of a ladder must share maturity and rate.");
+        }
+    }
+
+    // 1. Main tree
+    int n_fine = adjustSteps(steps, settings.type);
+    std::vector<double> fine = induct(options, model, n_fine, settings);
+    if (!settings.richardson) {
+        return fine;
+    }
+
+    // 2. Richardson extrapolation with the half-size tree: error ~ C / N^order
+    // (CRR prices oscillate with the parity of N: both trees keep the same parity)
+    int n_coarse = adjustSteps(std::max(2, n_fine / 2), settings.type);
+    if (settings.type != LatticeType::LeisenReimer && n_coarse % 2 != n_fine % 2) {
+        n_coarse += 1;
+    }
+    std::vector<double> coarse = induct(options, model, n_coarse, settings);
+
+    const double order = (settings.type == LatticeType::LeisenReimer) ? 2.0 : 1.0;
+    const double w_fine = std::pow(static_cast<double>(n_fine), order);
+    const double w_coarse = std::pow(static_cast<double>(n_coarse), order);
+    for (std::size_t l = 0; l < fine.size(); ++l) {
+        fine[l] = (w_fine * fine[l] - w_coarse * coarse[l]) / (w_fine - w_coarse);
+    }
+    return fine;
+}
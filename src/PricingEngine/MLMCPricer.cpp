@@ -0,0 +1,224 @@
+#include "PricingEngine/MLMCPricer.hpp"
+#include "Models/RNG.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <iostream>
+
+namespace {
+
+    // Share of the squared RMSE given to the bias (the remaining part goes to the variance).
+    const double BIAS_SHARE = 0.25;
+
+    // Samples buffered before being added to the level statistics in one block
+    const int SAMPLE_BLOCK = 256;
+
+    /**
+     * @brief Least squares slope of -log2(values[l]) against l, using levels 1..L.
+     * Level 0 is excluded since it is not a correction term.
+     */
+    double fitDecayRate(const std::vector<double>& values) {
+        double sx = 0.0, sy = 0.0, sxx = 0.0, sxy = 0.0;
+        int n = 0;
+        for (size_t l = 1; l < values.size(); ++l) {
+            if (values[l] <= 0.0) continue;
+            double x = static_cast<double>(l);
+            double y = -std::log2(values[l]);
+            sx += x; sy += y; sxx += x * x; sxy += x * y;
+            ++n;
+        }
+        if (n < 2) return 0.0;
+        return (n * sxy - sx * sy) / (n * sxx - sx * sx);
+    }
+}
+
+MLMCPricer::MLMCPricer(const Option& option_in, const GBM& model_in)
+    : option(option_in), model(model_in)
+{}
+
+void MLMCPricer::sampleLevel(int level, int base_steps, long num_paths,
+                             PayoffStatistics& stats) const {
+
+    const double T = option.getT();
+    const double mu = model.getMu();
+    const double sigma = model.getSigma();
+    const double S0 = model.getS0();
+
+    // 1. Fine and coarse time grids for this level
+    const int fine_steps = base_steps << level;
+    const int coarse_steps = fine_steps / 2;
+    const double h_fine = T / fine_steps;
+    const double h_coarse = 2.0 * h_fine;
+
+    const double drift_fine = (mu - 0.5 * sigma * sigma) * h_fine;
+    const double drift_coarse = (mu - 0.5 * sigma * sigma) * h_coarse;
+    const double sqrt_h_fine = std::sqrt(h_fine);
+
+    // 2. Path buffers reused for every sample (no allocation in the loop)
+    Path fine_path;
+    Path coarse_path;
+    std::vector<double>& fine = fine_path.data();
+    std::vector<double>& coarse = coarse_path.data();
+    fine.resize(fine_steps + 1);
+    coarse.resize(level > 0 ? coarse_steps + 1 : 0);
+
+    RNG& rng = RNG::getInstance();
+    double samples[SAMPLE_BLOCK];
+    int buffered = 0;
+
+    for (long n = 0; n < num_paths; ++n) {
+
+        if (buffered == SAMPLE_BLOCK) {
+            stats.add(samples, static_cast<std::size_t>(buffered));
+            buffered = 0;
+        }
+
+        fine[0] = S0;
+
+        if (level == 0) {
+            // Level 0: plain estimator of E[P_0]
+            for (int i = 0; i < fine_steps; ++i) {
+                double Z = rng.getStandardNormal();
+                fine[i + 1] = fine[i] * std::exp(drift_fine + sigma * sqrt_h_fine * Z);
+            }
+            samples[buffered++] = option.payoff(fine_path);
+            continue;
+        }
+
+        // 3. Coupled paths: each coarse increment is the sum of two fine increments
+        coarse[0] = S0;
+        for (int j = 0; j < coarse_steps; ++j) {
+            double dW1 = sqrt_h_fine * rng.getStandardNormal();
+            double dW2 = sqrt_h_fine * rng.getStandardNormal();
+
+            fine[2 * j + 1] = fine[2 * j] * std::exp(drift_fine + sigma * dW1);
+            fine[2 * j + 2] = fine[2 * j + 1] * std::exp(drift_fine + sigma * dW2);
+            coarse[j + 1] = coarse[j] * std::exp(drift_coarse + sigma * (dW1 + dW2));
+        }
+
+        // 4. Correction term Y_l = P_l - P_{l-1}
+        samples[buffered++] = option.payoff(fine_path) - option.payoff(coarse_path);
+    }
+    stats.add(samples, static_cast<std::size_t>(buffered));
+}
+
+MLMCResult MLMCPricer::calculatePrice(double target_rmse, int base_steps, int initial_paths,
+                                      int min_levels, int max_levels) const {
+
+    if (target_rmse <= 0.0 || base_steps <= 0 || initial_paths <= 1
+        || min_levels < 3 || max_levels < min_levels || max_levels > 20) {
+        throw std::invalid_argument("Error: MLMCPricer requires target_rmse > 0, base_steps > 0, initial_paths > 1 and 3 <= min_levels <= max_levels <= 20.");
+    }
+
+    const double eps2 = target_rmse * target_rmse;
+    const double discount_factor = option.getDiscountFactor();
+
+    // Per-level accumulators (undiscounted)
+    int L = min_levels - 1;
+    std::vector<long> N(L + 1, 0);
+    std::vector<long> dN(L + 1, initial_paths);
+    std::vector<PayoffStatistics> stats(L + 1);
+    std::vector<double> cost(L + 1), mean(L + 1), var(L + 1);
+
+    // Cost of one sample on level l: fine steps + coarse steps
+    auto levelCost = [base_steps](int l) {
+        double fine_steps = static_cast<double>(base_steps) * std::pow(2.0, l);
+        return (l == 0) ? fine_steps : 1.5 * fine_steps;
+    };
+    for (int l = 0; l <= L; ++l) cost[l] = levelCost(l);
+
+    double alpha = 0.5, beta = 0.5;
+    bool converged = false;
+
+    while (true) {
+
+        // 1. Draw the extra samples requested on each level
+        for (int l = 0; l <= L; ++l) {
+            if (dN[l] > 0) {
+                sampleLevel(l, base_steps, dN[l], stats[l]);
+                N[l] += dN[l];
+                dN[l] = 0;
+            }
+        }
+
+        // 2. Level means/variances and fitted decay rates
+        for (int l = 0; l <= L; ++l) {
+            mean[l] = std::abs(stats[l].getMean());
+            var[l] = stats[l].getVariance();
+        }
+        alpha = std::max(0.5, fitDecayRate(mean));
+        beta = std::max(0.5, fitDecayRate(var));
+
+        // Cope with levels whose sample mean or variance is (almost) zero by chance
+        for (int l = 2; l <= L; ++l) {
+            mean[l] = std::max(mean[l], 0.5 * mean[l - 1] / std::pow(2.0, alpha));
+            var[l] = std::max(var[l], 0.5 * var[l - 1] / std::pow(2.0, beta));
+        }
+
+        // 3. Optimal number of samples per level: N_l ~ sqrt(V_l / C_l) * sum_k sqrt(V_k C_k)
+        double sum_sqrt_vc = 0.0;
+        for (int l = 0; l <= L; ++l) sum_sqrt_vc += std::sqrt(var[l] * cost[l]);
+
+        // Variance target in undiscounted units
+        double var_target = (1.0 - BIAS_SHARE) * eps2 / (discount_factor * discount_factor);
+
+        bool needs_more = false;
+        for (int l = 0; l <= L; ++l) {
+            double optimal = std::ceil(std::sqrt(var[l] / cost[l]) * sum_sqrt_vc / var_target);
+            long target_n = static_cast<long>(std::max(optimal, 0.0));
+            dN[l] = std::max(0L, target_n - N[l]);
+            if (dN[l] > 0.01 * N[l]) needs_more = true;
+        }
+
+        if (needs_more) continue;
+
+        // 4. All levels are (almost) at their optimal size: test the remaining bias
+        double bias = mean[L] / (std::pow(2.0, alpha) - 1.0);
+        double bias_target = std::sqrt(BIAS_SHARE * eps2) / discount_factor;
+
+        if (bias <= bias_target) {
+            converged = true;
+            break;
+        }
+
+        if (L + 1 >= max_levels) {
+            std::cerr << "Warning: MLMC did not reach the bias target before the finest level (L = " << L << ").\n";
+            break;
+        }
+
+        // 5. Add a level, with a variance extrapolated from the previous one
+        ++L;
+        cost.push_back(levelCost(L));
+        var.push_back(var[L - 1] / std::pow(2.0, beta));
+        mean.push_back(mean[L - 1] / std::pow(2.0, alpha));
+        N.push_back(0);
+        stats.emplace_back();
+        dN.push_back(initial_paths);
+    }
+
+    // 6. Combine the levels
+    double price_undiscounted = 0.0;
+    double estimator_variance = 0.0;
+    double total_cost = 0.0;
+    std::vector<MLMCLevelStats> level_stats;
+
+    for (int l = 0; l <= L; ++l) {
+        double level_mean = stats[l].getMean();
+        double level_var = stats[l].getVariance();
+        price_undiscounted += level_mean;
+        estimator_variance += level_var / N[l];
+        total_cost += N[l] * cost[l];
+        level_stats.push_back({l, base_steps << l, N[l], level_mean, level_var, cost[l]});
+    }
+
+    double standard_error = discount_factor * std::sqrt(estimator_variance);
+    MLMCResult result(discount_factor * price_undiscounted, standard_error);
+    result.bias_estimate = discount_factor * std::abs(stats[L].getMean()) / (std::pow(2.0, alpha) - 1.0);
+    result.rmse_estimate = std::sqrt(standard_error * standard_error + result.bias_estimate * result.bias_estimate);
+    result.total_cost = total_cost;
+    result.alpha = alpha;
+    result.beta = beta;
+    result.converged = converged;
+    result.levels = level_stats;
+    return result;
+}
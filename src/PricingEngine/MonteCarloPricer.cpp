@@ -1,69 +1,197 @@
 #include "PricingEngine/MonteCarloPricer.hpp"
-#include "Models/GBM.hpp" 
+#include "Models/RNG.hpp"
+#include "Core/PathArena.hpp"
+#include "Utils/Instrumentation.hpp"
 #include <numeric>
 #include <cmath>
 #include <stdexcept>
 #include <iostream>
+#include <chrono>
+#include <algorithm>
+
+namespace {
+    // Number of paths generated together: small enough for the SoA block to stay in cache
+    const int SIMULATION_BLOCK = 256;
+}
 
 MonteCarloPricer::MonteCarloPricer(const Option& option_in, const AssetModel& model_in)
     : option(option_in), model(model_in)
 {}
 
-PricingResult MonteCarloPricer::calculatePrice(int num_simulations) const {
-    
-    std::vector<double> realized_payoffs;
-    realized_payoffs.reserve(num_simulations);
-    
-    double sum_payoffs = 0.0;
-    
-    // Get the time to maturity (T) from the Option object
+void MonteCarloPricer::setKeepDistribution(bool keep) {
+    keep_distribution = keep;
+}
+
+void MonteCarloPricer::setPayoffQuantiles(bool enable) {
+    keep_quantiles = enable;
+}
+
+void MonteCarloPricer::setPayoffHistogram(double lower, double upper, int bins) {
+    histogram_layout = FixedHistogram(lower, upper, bins);
+}
+
+void MonteCarloPricer::setPrecision(SimulationPrecision precision_in) {
+    precision = precision_in;
+}
+
+void MonteCarloPricer::setSampling(const SamplingScheme& scheme) {
+    sampling = scheme;
+}
+
+void MonteCarloPricer::accumulatePayoffs(int num_paths, PayoffStatistics& stats,
+                                         std::vector<double>* realized_payoffs,
+                                         QuantileSketch* quantiles, FixedHistogram* histogram) const {
+
     double T = option.getT();
 
-    // 1. Simulation Loop (The core Monte Carlo step)
-    for (int i = 0; i < num_simulations; ++i) {
-        
-        // A. Generate the Path
-        // Polymorphic call: uses the concrete model's generatePath() method (e.g., GBM)
-        Path path = model.generatePath(T); 
-
-        // B. Calculate the Payoff
-        // Polymorphic call: uses the concrete option's payoff() method (e.g., EuropeanCall, Butterfly)
-        double payoff = option.payoff(path);
-        
-        realized_payoffs.push_back(payoff);
-        sum_payoffs += payoff;
+    const bool float32 = (precision == SimulationPrecision::Float32);
+    PathBatch batch;
+    PathBatch32 batch32;
+    Path path;
+    double payoffs[SIMULATION_BLOCK];
+    double pair_averages[SIMULATION_BLOCK / 2 + 1];
+    PathArena& arena = PathArena::forThread();
+    const std::size_t length = model.getNumAssets() * static_cast<std::size_t>(model.getSteps() + 1);
+
+    // The generator of this thread draws with the scheme of the pricer for the whole run
+    RNG::SamplingScope sampling_scope(RNG::getInstance(), sampling);
+
+    for (int done = 0; done < num_paths; done += SIMULATION_BLOCK) {
+
+        // A. Generate a block of paths (polymorphic call: GBM, Heston...)
+        int block = std::min(SIMULATION_BLOCK, num_paths - done);
+        if (float32) {
+            batch32.resize(static_cast<std::size_t>(block), model.getSteps(), model.getNumAssets());
+            model.generatePathBatch32(T, batch32);
+        } else {
+            batch.resize(static_cast<std::size_t>(block), model.getSteps(), model.getNumAssets());
+            model.generatePathBatch(T, batch);
+        }
+
+        // B. Evaluate the payoff of each path of the block, through views over a
+        // path-major copy of the block held by the thread arena (no allocation).
+        // Float paths are widened to double by the copy.
+        {
+            PRICER_TIME_SCOPE(Payoff);
+            PathArena::Scope scope(arena);
+            double* paths = arena.allocate(static_cast<std::size_t>(block) * length);
+            if (float32) {
+                batch32.copyPathMajor(paths);
+            } else {
+                batch.copyPathMajor(paths);
+            }
+            for (int p = 0; p < block; ++p) {
+                path.setView(paths + static_cast<std::size_t>(p) * length, length, model.getNumAssets());
+                payoffs[p] = option.payoff(path);
+            }
+        }
+
+        // C. Accumulate the statistics of the block
+        {
+            PRICER_TIME_SCOPE(Statistics);
+            if (sampling.antithetic) {
+                // Paths 2i and 2i + 1 share opposite draws: their average is the independent sample
+                std::size_t pairs = 0;
+                for (int p = 0; p + 1 < block; p += 2) {
+                    pair_averages[pairs++] = 0.5 * (payoffs[p] + payoffs[p + 1]);
+                }
+                if (block % 2 != 0) pair_averages[pairs++] = payoffs[block - 1];
+                stats.add(pair_averages, pairs);
+            } else {
+                stats.add(payoffs, static_cast<std::size_t>(block));
+            }
+            if (realized_payoffs) {
+                realized_payoffs->insert(realized_payoffs->end(), payoffs, payoffs + block);
+            }
+            if (quantiles) quantiles->add(payoffs, static_cast<std::size_t>(block));
+            if (histogram) histogram->add(payoffs, static_cast<std::size_t>(block));
+        }
+        PRICER_COUNT(Paths, block);
     }
+}
 
-    // 2. Averaging and Discounting (Price Estimation)
+std::vector<PricingResult> MonteCarloPricer::calculatePortfolioPrices(const std::vector<const Option*>& options,
+                                                                      const AssetModel& model, int num_simulations,
+                                                                      bool keep_quantiles) {
 
-    // Discount factor e^(-rT)
-    double discount_factor = option.getDiscountFactor();
-    
-    // Mean Undiscounted Payoff (E[Payoff])
-    double mean_payoff = sum_payoffs / num_simulations;
-    
-    // Option Price (V = e^(-rT) * E[Payoff])
-    double price = discount_factor * mean_payoff;
-    
-    // 3. Standard Error Calculation (for Confidence Interval)
-    
-    // Calculate the variance of the payoffs (Var[Payoff])
-    double sum_sq_diff = 0.0;
-    for (double payoff : realized_payoffs) {
-        // Deviation from the mean payoff
-        double diff = payoff - mean_payoff;
-        sum_sq_diff += diff * diff;
+    if (options.empty()) {
+        throw std::invalid_argument("Error: calculatePortfolioPrices requires at least one option.");
+    }
+    const double T = options[0]->getT();
+    for (const Option* option : options) {
+        if (std::abs(option->getT() - T) > 1e-12 * std::max(1.0, T)) {
+            throw std::invalid_argument("Error: the options of a portfolio run must share the same maturity.");
+        }
+    }
+
+    std::vector<PayoffStatistics> stats(options.size());
+    std::vector<QuantileSketch> quantiles(options.size());
+    PathBatch batch;
+    Path path;
+    PathArena& arena = PathArena::forThread();
+    const std::size_t length = model.getNumAssets() * static_cast<std::size_t>(model.getSteps() + 1);
+
+    for (int done = 0; done < num_simulations; done += SIMULATION_BLOCK) {
+
+        // A. One block of paths for the whole portfolio
+        int block = std::min(SIMULATION_BLOCK, num_simulations - done);
+        batch.resize(static_cast<std::size_t>(block), model.getSteps(), model.getNumAssets());
+        model.generatePathBatch(T, batch);
+
+        // B. Every option is evaluated on every path (views over the arena copy of the block)
+        PRICER_TIME_SCOPE(Payoff);
+        PathArena::Scope scope(arena);
+        double* paths = arena.allocate(static_cast<std::size_t>(block) * length);
+        batch.copyPathMajor(paths);
+        for (int p = 0; p < block; ++p) {
+            path.setView(paths + static_cast<std::size_t>(p) * length, length, model.getNumAssets());
+            for (std::size_t i = 0; i < options.size(); ++i) {
+                double payoff = options[i]->payoff(path);
+                stats[i].add(payoff);
+                if (keep_quantiles) quantiles[i].add(payoff);
+            }
+        }
+        PRICER_COUNT(Paths, block);
+    }
+
+    std::vector<PricingResult> results;
+    results.reserve(options.size());
+    for (std::size_t i = 0; i < options.size(); ++i) {
+        results.emplace_back(stats[i], model.getDiscountFactor(options[i]->getT(), options[i]->getR()));
+        quantiles[i].flush();
+        results.back().quantiles = std::move(quantiles[i]);
     }
-    // Sample variance of the undiscounted payoffs (using N-1 for unbiased estimator)
-    double payoff_variance = sum_sq_diff / (num_simulations - 1); 
+    return results;
+}
+
+PricingResult MonteCarloPricer::calculatePrice(int num_simulations) const {
     
-    // Standard Error of the Mean (SEM)
-    // SEM = [e^(-rT) * sqrt(Var(Payoff))] / sqrt(N)
-    double standard_error = discount_factor * std::sqrt(payoff_variance / num_simulations);
+    std::vector<double> realized_payoffs;
+    if (keep_distribution) {
+        realized_payoffs.reserve(num_simulations);
+    }
     
+    // Running sufficient statistics (count, mean, central moments) and bounded-memory
+    // distribution summaries of the payoffs
+    PayoffStatistics stats;
+    QuantileSketch quantiles;
+    FixedHistogram histogram = histogram_layout;
     
-    // 4. Return the Results
-    return PricingResult(price, standard_error, realized_payoffs);
+    // 1. Simulation Loop (The core Monte Carlo step)
+    const Instrumentation::Snapshot before = Instrumentation::threadSnapshot();
+    accumulatePayoffs(num_simulations, stats, keep_distribution ? &realized_payoffs : nullptr,
+                      keep_quantiles ? &quantiles : nullptr, &histogram);
+
+    // 2. Averaging, Discounting and Standard Error
+    // Price V = e^(-rT) * E[Payoff], e^(-int_0^T r) for models with a rate curve
+    // SEM = [e^(-rT) * sqrt(Var(Payoff))] / sqrt(N), with the unbiased (N-1) variance
+    PricingResult result(stats, model.getDiscountFactor(option.getT(), option.getR()), realized_payoffs);
+    result.paths_per_sample = sampling.antithetic ? 2 : 1;
+    quantiles.flush();
+    result.quantiles = std::move(quantiles);
+    result.histogram = std::move(histogram);
+    result.instrumentation = Instrumentation::threadSnapshot() - before;
+    return result;
 }
 
 PricingResult MonteCarloPricer::calculatePriceMinVar(int num_simulations) const {
@@ -72,74 +200,133 @@ PricingResult MonteCarloPricer::calculatePriceMinVar(int num_simulations) const
         std::cerr << "Error: The number of simulations must be even for the Antithetic Variates method.\n";
         return PricingResult(0.0, 0.0, {});
     }
-    
-    // N_pairs is the number of independent samples (pairs)
-    int num_pairs = num_simulations / 2; 
-    
-    // We only need to store the realized payoff averages for the true SEM calculation
-    std::vector<double> paired_average_payoffs;
-    paired_average_payoffs.reserve(num_pairs);
-    
-    double sum_payoffs = 0.0;
-    double T = option.getT();
 
-    // Downcast to GBM to access generateMinVarPaths
-    const GBM* gbm_model = dynamic_cast<const GBM*>(&model);
-    if (!gbm_model) {
-        std::cerr << "Error: The MinVar method requires a GBM model (or an implementation of generateMinVarPaths).\n";
-        return PricingResult(0.0, 0.0, {});
+    // Antithetic pairs are drawn by the RNG layer, so any model qualifies. The blocks
+    // hold an even number of paths, hence the N/2 pairs never straddle two blocks.
+    // Var(V_AV) = Var(Average_Payoff_Pair) / N_pairs (see accumulatePayoffs)
+    MonteCarloPricer antithetic_pricer(*this);
+    antithetic_pricer.sampling.antithetic = true;
+    return antithetic_pricer.calculatePrice(num_simulations);
+}
+
+AdaptivePricingResult MonteCarloPricer::calculatePriceAdaptive(const AdaptiveSettings& settings,
+                                                               const ProgressCallback& on_batch) const {
+    const double discount_factor = model.getDiscountFactor(option.getT(), option.getR());
+    return resumePriceAdaptive(settings, PricingResult(PayoffStatistics(), discount_factor), on_batch);
+}
+
+AdaptivePricingResult MonteCarloPricer::resumePriceAdaptive(const AdaptiveSettings& settings,
+                                                            const PricingResult& checkpoint,
+                                                            const ProgressCallback& on_batch) const {
+
+    if (settings.batch_size <= 0 || settings.max_paths <= 0) {
+        throw std::invalid_argument("Error: AdaptiveSettings requires batch_size > 0 and max_paths > 0.");
+    }
+
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point start = Clock::now();
+
+    double discount_factor = model.getDiscountFactor(option.getT(), option.getR());
+
+    // With antithetic pairs an observation of stats is a pair: the checkpoint records
+    // which kind of observation it holds, and the run must continue with the same kind
+    const bool antithetic = sampling.antithetic;
+    const int paths_per_sample = antithetic ? 2 : 1;
+    if (checkpoint.statistics.getCount() > 0) {
+        if (std::abs(checkpoint.discount_factor - discount_factor) > 1e-12 * discount_factor) {
+            throw std::invalid_argument("Error: the checkpoint was computed for a different discount factor.");
+        }
+        if (checkpoint.paths_per_sample != paths_per_sample) {
+            throw std::invalid_argument("Error: the checkpoint was computed with a different antithetic setting.");
+        }
     }
 
-    // 1. Simulation Loop (N/2 iterations)
-    for (int i = 0; i < num_pairs; ++i) {
-        
-        // Generate the pair of paths (Path_i and Path'_i)
-        std::pair<Path, Path> path_pair = gbm_model->generateMinVarPaths(T); 
-        
-        double payoff_std = option.payoff(path_pair.first);
-        double payoff_anti = option.payoff(path_pair.second);
-        
-        // Calculate the average payoff for the current pair
-        double average_payoff_pair = (payoff_std + payoff_anti) / 2.0;
-
-        // Store the average payoff for the SEM calculation
-        paired_average_payoffs.push_back(average_payoff_pair);
-        
-        // Accumulate the total sum (which equals the sum of the averages)
-        sum_payoffs += payoff_std + payoff_anti;
+    std::vector<double> realized_payoffs;
+    if (settings.keep_distribution) {
+        realized_payoffs = checkpoint.payoff_distribution;
     }
 
-    // 2. Discounting and Averaging (Price Estimation)
+    // Running sufficient statistics of the payoffs, starting from the checkpoint
+    PayoffStatistics stats = checkpoint.statistics;
+    QuantileSketch quantiles = checkpoint.quantiles;
+    FixedHistogram histogram = checkpoint.histogram.isEnabled() ? checkpoint.histogram : histogram_layout;
 
-    double discount_factor = option.getDiscountFactor();
-    
-    // Mean Payoff (E[Payoff]) is the average of all N payoffs
-    double mean_payoff = sum_payoffs / num_simulations;
-    double price = discount_factor * mean_payoff;
-    
-    // 3. Correct Standard Error Calculation (SEM_AV)
-    
-    // The correct formula uses the variance of the paired averages:
-    // Var(V_AV) = Var(Average_Payoff_Pair) / N_pairs
-
-    // First, calculate the sum of squared differences from the mean (using paired averages)
-    double sum_sq_diff_paired = 0.0;
-    for (double avg_payoff : paired_average_payoffs) {
-        // We use the overall mean_payoff (which is the sample mean of the paired averages)
-        double diff = avg_payoff - mean_payoff; 
-        sum_sq_diff_paired += diff * diff;
+    double price = 0.0;
+    double standard_error = 0.0;
+    double elapsed = 0.0;
+    StopReason reason = StopReason::MaxPaths;
+    const Instrumentation::Snapshot before = Instrumentation::threadSnapshot();
+
+    // The budget counts simulated paths, and antithetic batches have an even size so
+    // that no pair is split between two batches
+    const int batch_size = (antithetic && settings.batch_size % 2 != 0) ? settings.batch_size + 1
+                                                                        : settings.batch_size;
+    int n = static_cast<int>(checkpoint.getPathCount());
+
+    while (true) {
+
+        // 1. Simulate one batch (truncated so that max_paths is never exceeded)
+        int batch = std::min(batch_size, settings.max_paths - n);
+        if (antithetic) batch -= batch % 2;
+        if (batch <= 0) {
+            reason = StopReason::MaxPaths;
+            break;
+        }
+        accumulatePayoffs(batch, stats, settings.keep_distribution ? &realized_payoffs : nullptr,
+                          settings.keep_quantiles ? &quantiles : nullptr, &histogram);
+
+        // 2. Update the price and its standard error
+        n += batch;
+        price = discount_factor * stats.getMean();
+        standard_error = discount_factor * stats.getStandardErrorOfMean();
+        elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+        // 3. Report the interim quote (the observer may cancel the run)
+        if (on_batch) {
+            PricingProgress progress;
+            progress.fraction = static_cast<double>(n) / settings.max_paths;
+            if (settings.time_budget_seconds > 0.0) {
+                progress.fraction = std::max(progress.fraction, elapsed / settings.time_budget_seconds);
+            }
+            progress.fraction = std::min(progress.fraction, 1.0);
+            progress.paths = n;
+            progress.price = price;
+            progress.standard_error = standard_error;
+            if (!on_batch(progress)) {
+                reason = StopReason::Cancelled;
+                break;
+            }
+        }
+
+        // 4. Stopping rules (precision targets first, then budgets)
+        bool enough_paths = (n >= settings.min_paths) && (stats.getCount() > 1);
+
+        if (enough_paths && settings.target_absolute_error > 0.0
+            && standard_error <= settings.target_absolute_error) {
+            reason = StopReason::TargetAbsoluteError;
+            break;
+        }
+        if (enough_paths && settings.target_relative_error > 0.0
+            && standard_error <= settings.target_relative_error * std::abs(price)) {
+            reason = StopReason::TargetRelativeError;
+            break;
+        }
+        if (settings.time_budget_seconds > 0.0 && elapsed >= settings.time_budget_seconds) {
+            reason = StopReason::TimeBudget;
+            break;
+        }
+        if (n >= settings.max_paths) {
+            reason = StopReason::MaxPaths;
+            break;
+        }
     }
-    
-    // Payoff Variance of the PAIRED AVERAGE (Var(Avg_Payoff_Pair))
-    // We use N_pairs - 1 for unbiased estimator.
-    double paired_payoff_variance = sum_sq_diff_paired / (num_pairs - 1); 
-    
-    // Standard Error of the Mean (SEM_AV)
-    // SEM = [e^(-rT) * sqrt(Var(Avg_Payoff_Pair))] / sqrt(N_pairs)
-    double standard_error = discount_factor * std::sqrt(paired_payoff_variance / num_pairs);
-    
-    // 4. Return the Results
-    // NOTE: realized_payoffs is now incorrect (contains paired averages), so we return an empty vector for the distribution.
-    // If you absolutely need the distribution, you must revert to storing all individual N payoffs.
-    return PricingResult(price, standard_error, {}); // Returning empty distribution vector for simplicity
+
+    AdaptivePricingResult result(stats, discount_factor, realized_payoffs, reason, elapsed, n);
+    result.paths_per_sample = paths_per_sample;
+    quantiles.flush();
+    result.quantiles = std::move(quantiles);
+    result.histogram = std::move(histogram);
+    result.instrumentation = checkpoint.instrumentation;
+    result.instrumentation += Instrumentation::threadSnapshot() - before;
+    return result;
 }
\ No newline at end of file
@@ -0,0 +1,149 @@
+#include "PricingEngine/PayoffStatistics.hpp"
+#include "Utils/BinaryIO.hpp"
+#include <algorithm>
+#include <cmath>
+
+void PayoffStatistics::add(double x) {
+
+    // Single-pass update of the central moments (Pébay, 2008)
+    double n1 = static_cast<double>(count);
+    ++count;
+    double n = static_cast<double>(count);
+
+    double delta = x - mean;
+    double delta_n = delta / n;
+    double delta_n2 = delta_n * delta_n;
+    double term1 = delta * delta_n * n1;
+
+    mean += delta_n;
+    m4 += term1 * delta_n2 * (n * n - 3.0 * n + 3.0) + 6.0 * delta_n2 * m2 - 4.0 * delta_n * m3;
+    m3 += term1 * delta_n * (n - 2.0) - 3.0 * delta_n * m2;
+    m2 += term1;
+
+    if (count == 1) {
+        min_value = x;
+        max_value = x;
+    } else {
+        min_value = std::min(min_value, x);
+        max_value = std::max(max_value, x);
+    }
+}
+
+void PayoffStatistics::add(const double* values, std::size_t n) {
+
+    if (n == 0) return;
+
+    // 1. Block mean by compensated summation (Neumaier), with min and max
+    PayoffStatistics block;
+    double sum = 0.0;
+    double compensation = 0.0;
+    block.min_value = values[0];
+    block.max_value = values[0];
+    for (std::size_t i = 0; i < n; ++i) {
+        const double x = values[i];
+        const double t = sum + x;
+        compensation += (std::abs(sum) >= std::abs(x)) ? (sum - t) + x : (x - t) + sum;
+        sum = t;
+        block.min_value = std::min(block.min_value, x);
+        block.max_value = std::max(block.max_value, x);
+    }
+    const double count_block = static_cast<double>(n);
+    block.mean = (sum + compensation) / count_block;
+
+    // 2. Central moments around the block mean (the block is still in cache). The sum of
+    // the deviations, zero in exact arithmetic, corrects the rounding of the mean in M2.
+    double sum_d = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double d = values[i] - block.mean;
+        const double d2 = d * d;
+        sum_d += d;
+        block.m2 += d2;
+        block.m3 += d2 * d;
+        block.m4 += d2 * d2;
+    }
+    block.m2 -= sum_d * sum_d / count_block;
+    block.count = n;
+
+    // 3. Pairwise combination with the running moments
+    merge(block);
+}
+
+void PayoffStatistics::merge(const PayoffStatistics& other) {
+
+    if (other.count == 0) return;
+    if (count == 0) {
+        *this = other;
+        return;
+    }
+
+    // Pairwise combination of the moments (Chan et al. 1979, Pébay 2008)
+    double na = static_cast<double>(count);
+    double nb = static_cast<double>(other.count);
+    double n = na + nb;
+
+    double delta = other.mean - mean;
+    double delta2 = delta * delta;
+    double delta3 = delta2 * delta;
+    double delta4 = delta2 * delta2;
+
+    double new_m2 = m2 + other.m2 + delta2 * na * nb / n;
+
+    double new_m3 = m3 + other.m3
+                  + delta3 * na * nb * (na - nb) / (n * n)
+                  + 3.0 * delta * (na * other.m2 - nb * m2) / n;
+
+    double new_m4 = m4 + other.m4
+                  + delta4 * na * nb * (na * na - na * nb + nb * nb) / (n * n * n)
+                  + 6.0 * delta2 * (na * na * other.m2 + nb * nb * m2) / (n * n)
+                  + 4.0 * delta * (na * other.m3 - nb * m3) / n;
+
+    mean += delta * nb / n;
+    m2 = new_m2;
+    m3 = new_m3;
+    m4 = new_m4;
+    count += other.count;
+    min_value = std::min(min_value, other.min_value);
+    max_value = std::max(max_value, other.max_value);
+}
+
+double PayoffStatistics::getVariance() const {
+    if (count < 2) return 0.0;
+    return m2 / static_cast<double>(count - 1);
+}
+
+double PayoffStatistics::getStandardErrorOfMean() const {
+    if (count < 2) return 0.0;
+    return std::sqrt(getVariance() / static_cast<double>(count));
+}
+
+double PayoffStatistics::getSkewness() const {
+    if (count < 2 || m2 <= 0.0) return 0.0;
+    return std::sqrt(static_cast<double>(count)) * m3 / std::pow(m2, 1.5);
+}
+
+double PayoffStatistics::getExcessKurtosis() const {
+    if (count < 2 || m2 <= 0.0) return 0.0;
+    return static_cast<double>(count) * m4 / (m2 * m2) - 3.0;
+}
+
+void PayoffStatistics::writeBinary(std::ostream& os) const {
+    BinaryIO::writeU64(os, count);
+    BinaryIO::writeDouble(os, mean);
+    BinaryIO::writeDouble(os, m2);
+    BinaryIO::writeDouble(os, m3);
+    BinaryIO::writeDouble(os, m4);
+    BinaryIO::writeDouble(os, min_value);
+    BinaryIO::writeDouble(os, max_value);
+}
+
+PayoffStatistics PayoffStatistics::readBinary(std::istream& is) {
+    PayoffStatistics stats;
+    stats.count = BinaryIO::readU64(is);
+    stats.mean = BinaryIO::readDouble(is);
+    stats.m2 = BinaryIO::readDouble(is);
+    stats.m3 = BinaryIO::readDouble(is);
+    stats.m4 = BinaryIO::readDouble(is);
+    stats.min_value = BinaryIO::readDouble(is);
+    stats.max_value = BinaryIO::readDouble(is);
+    return stats;
+}
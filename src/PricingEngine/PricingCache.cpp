@@ -0,0 +1,279 @@
+#include "PricingEngine/PricingCache.hpp"
+#include "PricingEngine/MonteCarloPricer.hpp"
+#include "PricingEngine/EDPSolver.hpp"
+#include "Options/EuropeanCall.hpp"
+#include "Options/EuropeanPut.hpp"
+#include "Models/GBM.hpp"
+#include "Models/RNG.hpp"
+#include "Utils/BinaryIO.hpp"
+#include "Utils/BlackScholesFormulas.hpp"
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+
+    // "OPPC" tag followed by the format version
+    const std::uint32_t CACHE_MAGIC = 0x4350504F;
+    const std::uint32_t CACHE_VERSION = 1;
+
+    // Fixed cost of an entry besides its key and distribution (list node, map node, result)
+    const std::size_t ENTRY_OVERHEAD = 160;
+
+    std::uint64_t fnv1a(const std::string& text) {
+        std::uint64_t hash = 14695981039346656037ULL;
+        for (unsigned char c : text) {
+            hash ^= c;
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    void appendName(std::string& text, const std::string& name) {
+        text += name;
+        text += '\0';
+    }
+
+    void appendValues(std::string& text, const std::vector<double>& values) {
+        std::uint32_t count = static_cast<std::uint32_t>(values.size());
+        text.append(reinterpret_cast<const char*>(&count), sizeof(count));
+        text.append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(double));
+    }
+
+    std::size_t entrySize(const std::string& key, const PricingResult& result) {
+        return ENTRY_OVERHEAD + key.size() + result.payoff_distribution.size() * sizeof(double)
+               + result.quantiles.getMemoryBytes() + result.histogram.getBins() * sizeof(std::uint64_t);
+    }
+}
+
+// --- PricingKey ---
+
+PricingKey::PricingKey(const std::string& engine, const Option& option, const AssetModel& model,
+                       const std::vector<double>& engine_parameters)
+{
+    const std::string option_name = option.getName();
+    const std::string model_name = model.getName();
+    cacheable = !option_name.empty() && !model_name.empty();
+
+    appendName(text, engine);
+    appendName(text, option_name);
+    appendValues(text, option.getParameters());
+    appendName(text, model_name);
+    appendValues(text, model.getParameters());
+    appendValues(text, engine_parameters);
+    hash = fnv1a(text);
+}
+
+// --- PricingCache ---
+
+PricingCache::PricingCache(std::size_t max_bytes, std::size_t num_stripes)
+    : hits(0), misses(0), evictions(0)
+{
+    if (num_stripes == 0) {
+        throw std::invalid_argument("Error: PricingCache requires at least one stripe.");
+    }
+    for (std::size_t i = 0; i < num_stripes; ++i) {
+        stripes.push_back(std::make_unique<Stripe>());
+    }
+    stripe_budget = max_bytes / num_stripes;
+}
+
+PricingCache& PricingCache::shared() {
+    static PricingCache cache;
+    return cache;
+}
+
+bool PricingCache::lookup(const PricingKey& key, PricingResult& out) {
+
+    if (!key.isCacheable()) {
+        misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    Stripe& stripe = stripeFor(key);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+
+    auto it = stripe.index.find(key.getText());
+    if (it == stripe.index.end()) {
+        misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Move the entry to the front of the LRU list
+    stripe.lru.splice(stripe.lru.begin(), stripe.lru, it->second);
+    out = it->second->result;
+    hits.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void PricingCache::insert(const PricingKey& key, const PricingResult& result) {
+    if (key.isCacheable()) {
+        insertText(key.getText(), key.getHash(), result);
+    }
+}
+
+void PricingCache::insertText(const std::string& text, std::uint64_t hash, const PricingResult& result) {
+
+    const std::size_t bytes = entrySize(text, result);
+    if (bytes > stripe_budget) return;
+
+    Stripe& stripe = *stripes[hash % stripes.size()];
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+
+    // 1. Replace an existing entry
+    auto it = stripe.index.find(text);
+    if (it != stripe.index.end()) {
+        stripe.bytes -= it->second->bytes;
+        stripe.lru.erase(it->second);
+        stripe.index.erase(it);
+    }
+
+    // 2. Evict from the back of the list until the new entry fits
+    while (!stripe.lru.empty() && stripe.bytes + bytes > stripe_budget) {
+        Entry& victim = stripe.lru.back();
+        stripe.bytes -= victim.bytes;
+        stripe.index.erase(victim.key);
+        stripe.lru.pop_back();
+        evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    stripe.lru.push_front(Entry{text, result, bytes});
+    stripe.index.emplace(text, stripe.lru.begin());
+    stripe.bytes += bytes;
+}
+
+PricingResult PricingCache::getOrCompute(const PricingKey& key, const std::function<PricingResult()>& compute) {
+    PricingResult result(0.0, 0.0, {});
+    if (lookup(key, result)) {
+        return result;
+    }
+    result = compute();
+    insert(key, result);
+    return result;
+}
+
+PricingResult PricingCache::priceMonteCarlo(const Option& option, const AssetModel& model,
+                                            int num_simulations, std::uint64_t seed) {
+    PricingKey key("mc", option, model, {static_cast<double>(num_simulations), static_cast<double>(seed)});
+    return getOrCompute(key, [&]() {
+        RNG::getInstance().seed(seed);
+        PayoffStatistics stats;
+        QuantileSketch quantiles;
+        MonteCarloPricer(option, model).accumulatePayoffs(num_simulations, stats, nullptr, &quantiles);
+        PricingResult result(stats, model.getDiscountFactor(option.getT(), option.getR()));
+        quantiles.flush();
+        result.quantiles = std::move(quantiles);
+        return result;
+    });
+}
+
+double PricingCache::priceEDP(const Option& option, const GBM& model, double S_max, int M, int N) {
+    PricingKey key("edp", option, model, {S_max, static_cast<double>(M), static_cast<double>(N)});
+    return getOrCompute(key, [&]() {
+        return PricingResult(EDPSolver(option, model).solve(S_max, M, N), 0.0, {});
+    }).price;
+}
+
+double PricingCache::priceAnalytic(const Option& option, const GBM& model) {
+    PricingKey key("analytic", option, model);
+    return getOrCompute(key, [&]() {
+        double price;
+        if (const EuropeanCall* call = dynamic_cast<const EuropeanCall*>(&option)) {
+            price = BlackScholesFormulas::callPrice(model.getS0(), call->getK(), option.getT(),
+                                                    option.getR(), model.getSigma());
+        } else if (const EuropeanPut* put = dynamic_cast<const EuropeanPut*>(&option)) {
+            price = BlackScholesFormulas::putPrice(model.getS0(), put->getK(), option.getT(),
+                                                   option.getR(), model.getSigma());
+        } else {
+            throw std::invalid_argument("Error: priceAnalytic only prices European calls and puts.");
+        }
+        return PricingResult(price, 0.0, {});
+    }).price;
+}
+
+std::size_t PricingCache::getEntryCount() const {
+    std::size_t count = 0;
+    for (const std::unique_ptr<Stripe>& stripe : stripes) {
+        std::lock_guard<std::mutex> lock(stripe->mutex);
+        count += stripe->lru.size();
+    }
+    return count;
+}
+
+std::size_t PricingCache::getSizeBytes() const {
+    std::size_t bytes = 0;
+    for (const std::unique_ptr<Stripe>& stripe : stripes) {
+        std::lock_guard<std::mutex> lock(stripe->mutex);
+        bytes += stripe->bytes;
+    }
+    return bytes;
+}
+
+void PricingCache::clear() {
+    for (const std::unique_ptr<Stripe>& stripe : stripes) {
+        std::lock_guard<std::mutex> lock(stripe->mutex);
+        stripe->lru.clear();
+        stripe->index.clear();
+        stripe->bytes = 0;
+    }
+}
+
+void PricingCache::save(const std::string& filename) const {
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw std::runtime_error("Error: cannot open cache file " + filename);
+    }
+
+    BinaryIO::writeU32(file, CACHE_MAGIC);
+    BinaryIO::writeU32(file, CACHE_VERSION);
+
+    // Entries are written stripe by stripe, least recently used first, so that
+    // load() restores the recency order
+    for (const std::unique_ptr<Stripe>& stripe : stripes) {
+        std::lock_guard<std::mutex> lock(stripe->mutex);
+        for (auto it = stripe->lru.rbegin(); it != stripe->lru.rend(); ++it) {
+            BinaryIO::writeU32(file, 1);
+            BinaryIO::writeU32(file, static_cast<std::uint32_t>(it->key.size()));
+            file.write(it->key.data(), static_cast<std::streamsize>(it->key.size()));
+            BinaryIO::writeDouble(file, it->result.price);
+            BinaryIO::writeDouble(file, it->result.standard_error);
+            it->result.writeBinary(file, true);
+        }
+    }
+    BinaryIO::writeU32(file, 0);
+
+    if (!file) {
+        throw std::runtime_error("Error: failed to write cache file " + filename);
+    }
+}
+
+void PricingCache::load(const std::string& filename) {
+
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Error: cannot open cache file " + filename);
+    }
+    if (BinaryIO::readU32(file) != CACHE_MAGIC) {
+        throw std::runtime_error("Error: not a pricing cache file: " + filename);
+    }
+    if (BinaryIO::readU32(file) != CACHE_VERSION) {
+        throw std::runtime_error("Error: unsupported pricing cache version.");
+    }
+
+    while (BinaryIO::readU32(file) == 1) {
+        std::uint32_t size = BinaryIO::readU32(file);
+        std::string key(size, '\0');
+        if (size > 0 && !file.read(&key[0], size)) {
+            throw std::runtime_error("Error: truncated binary stream.");
+        }
+        double price = BinaryIO::readDouble(file);
+        double standard_error = BinaryIO::readDouble(file);
+        PricingResult result = PricingResult::readBinary(file);
+
+        // Scalar results (EDP, analytic) have no statistics to rebuild the price from
+        result.price = price;
+        result.standard_error = standard_error;
+        insertText(key, fnv1a(key), result);
+    }
+}
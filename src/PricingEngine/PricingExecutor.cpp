@@ -0,0 +1,62 @@
+#include "PricingEngine/PricingExecutor.hpp"
+#include <algorithm>
+
+PricingExecutor::PricingExecutor(unsigned num_threads) {
+    if (num_threads == 0) {
+        num_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    workers.reserve(num_threads);
+    for (unsigned i = 0; i < num_threads; ++i) {
+        workers.emplace_back(&PricingExecutor::workerLoop, this);
+    }
+}
+
+PricingExecutor::~PricingExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    available.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void PricingExecutor::submit(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(std::move(task));
+    }
+    available.notify_one();
+}
+
+bool PricingExecutor::isWorkerThread() const {
+    const std::thread::id self = std::this_thread::get_id();
+    return std::any_of(workers.begin(), workers.end(),
+                       [self](const std::thread& worker) { return worker.get_id() == self; });
+}
+
+PricingExecutor& PricingExecutor::shared() {
+    static PricingExecutor instance;
+    return instance;
+}
+
+void PricingExecutor::workerLoop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            available.wait(lock, [this] { return stopping || !tasks.empty(); });
+            // Drain the queue before stopping: a discarded task would leave its promise
+            // unset and any thread waiting on it (e.g. a PricingJob) blocked forever
+            if (tasks.empty()) return;
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        try {
+            task();
+        } catch (...) {
+            // Tasks report their own errors; never let one kill a worker thread
+        }
+    }
+}
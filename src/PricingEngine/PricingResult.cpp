@@ -0,0 +1,138 @@
+#include "PricingEngine/PricingResult.hpp"
+#include "Utils/BinaryIO.hpp"
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+
+    // "OPPR" tag followed by the format version
+    const std::uint32_t RESULT_MAGIC = 0x5250504F;
+    // 2: quantile sketch and histogram, 3: paths per sample, 4: NaN count of the histogram
+    const std::uint32_t RESULT_VERSION = 4;
+
+    // Upper bound of the up-front reservation of the payoff distribution: the stored
+    // size comes from the stream, larger distributions grow as their values are read
+    const std::uint64_t MAX_DISTRIBUTION_RESERVE = 1u << 20;
+}
+
+PricingResult::PricingResult(const PayoffStatistics& stats, double df, const std::vector<double>& dist)
+    : price(0.0), standard_error(0.0), payoff_distribution(dist), statistics(stats), discount_factor(df)
+{
+    refreshFromStatistics();
+}
+
+void PricingResult::refreshFromStatistics() {
+    price = discount_factor * statistics.getMean();
+    standard_error = discount_factor * statistics.getStandardErrorOfMean();
+}
+
+void PricingResult::merge(const PricingResult& other) {
+
+    if (other.statistics.getCount() == 0) return;
+
+    if (statistics.getCount() == 0) {
+        discount_factor = other.discount_factor;
+        paths_per_sample = other.paths_per_sample;
+    } else if (std::abs(discount_factor - other.discount_factor) > 1e-12 * std::abs(discount_factor)) {
+        throw std::invalid_argument("Error: cannot merge pricing results with different discount factors.");
+    } else if (paths_per_sample != other.paths_per_sample) {
+        throw std::invalid_argument("Error: cannot merge antithetic pair statistics with plain payoff statistics.");
+    }
+
+    statistics.merge(other.statistics);
+    payoff_distribution.insert(payoff_distribution.end(),
+                               other.payoff_distribution.begin(), other.payoff_distribution.end());
+    quantiles.merge(other.quantiles);
+    histogram.merge(other.histogram);
+    instrumentation += other.instrumentation;
+    refreshFromStatistics();
+}
+
+double PricingResult::getValueAtRisk(double confidence, bool short_position) const {
+    if (short_position) {
+        return discount_factor * quantiles.getQuantile(confidence) - price;
+    }
+    return price - discount_factor * quantiles.getQuantile(1.0 - confidence);
+}
+
+double PricingResult::getExpectedShortfall(double confidence, bool short_position) const {
+    if (short_position) {
+        return discount_factor * quantiles.getUpperTailMean(confidence) - price;
+    }
+    return price - discount_factor * quantiles.getLowerTailMean(1.0 - confidence);
+}
+
+void PricingResult::writeBinary(std::ostream& os, bool include_distribution) const {
+
+    BinaryIO::writeU32(os, RESULT_MAGIC);
+    BinaryIO::writeU32(os, RESULT_VERSION);
+    BinaryIO::writeDouble(os, discount_factor);
+    statistics.writeBinary(os);
+    BinaryIO::writeU32(os, static_cast<std::uint32_t>(paths_per_sample));
+
+    std::uint64_t dist_size = include_distribution ? payoff_distribution.size() : 0;
+    BinaryIO::writeU64(os, dist_size);
+    for (std::uint64_t i = 0; i < dist_size; ++i) {
+        BinaryIO::writeDouble(os, payoff_distribution[i]);
+    }
+    quantiles.writeBinary(os);
+    histogram.writeBinary(os);
+}
+
+PricingResult PricingResult::readBinary(std::istream& is) {
+
+    if (BinaryIO::readU32(is) != RESULT_MAGIC) {
+        throw std::runtime_error("Error: not a serialized PricingResult.");
+    }
+    std::uint32_t version = BinaryIO::readU32(is);
+    if (version == 0 || version > RESULT_VERSION) {
+        throw std::runtime_error("Error: unsupported PricingResult format version.");
+    }
+
+    double df = BinaryIO::readDouble(is);
+    PayoffStatistics stats = PayoffStatistics::readBinary(is);
+
+    std::uint32_t paths_per_sample = (version >= 3) ? BinaryIO::readU32(is) : 1;
+    if (paths_per_sample != 1 && paths_per_sample != 2) {
+        throw std::runtime_error("Error: corrupted PricingResult (invalid paths per sample).");
+    }
+
+    // The distribution holds at most one payoff per simulated path
+    std::uint64_t dist_size = BinaryIO::readU64(is);
+    if (dist_size / paths_per_sample + (dist_size % paths_per_sample != 0) > stats.getCount()) {
+        throw std::runtime_error("Error: corrupted PricingResult (distribution larger than the path count).");
+    }
+    std::vector<double> dist;
+    dist.reserve(static_cast<std::size_t>(std::min(dist_size, MAX_DISTRIBUTION_RESERVE)));
+    for (std::uint64_t i = 0; i < dist_size; ++i) {
+        dist.push_back(BinaryIO::readDouble(is));
+    }
+
+    PricingResult result(stats, df, dist);
+    result.paths_per_sample = static_cast<int>(paths_per_sample);
+    if (version >= 2) {
+        result.quantiles = QuantileSketch::readBinary(is);
+        result.histogram = FixedHistogram::readBinary(is, version >= 4);
+    }
+    return result;
+}
+
+void PricingResult::saveCheckpoint(const std::string& filename, bool include_distribution) const {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw std::runtime_error("Error: cannot open checkpoint file " + filename);
+    }
+    writeBinary(file, include_distribution);
+    if (!file) {
+        throw std::runtime_error("Error: failed to write checkpoint file " + filename);
+    }
+}
+
+PricingResult PricingResult::loadCheckpoint(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Error: cannot open checkpoint file " + filename);
+    }
+    return readBinary(file);
+}
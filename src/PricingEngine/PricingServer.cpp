@@ -0,0 +1,584 @@
+#include "PricingEngine/PricingServer.hpp"
+#include "PricingEngine/MonteCarloPricer.hpp"
+#include "PricingEngine/PricingCache.hpp"
+#include "PricingEngine/TradePricer.hpp"
+#include "Models/RNG.hpp"
+#include "Utils/Instrumentation.hpp"
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define PRICER_HAS_SOCKETS 1
+    #include <cerrno>
+    #include <cstring>
+    #include <fcntl.h>
+    #include <arpa/inet.h>
+    #include <netinet/in.h>
+    #include <netinet/tcp.h>
+    #include <poll.h>
+    #include <sys/socket.h>
+    #include <sys/un.h>
+    #include <unistd.h>
+#endif
+
+#ifndef MSG_NOSIGNAL
+    #define MSG_NOSIGNAL 0
+#endif
+
+struct PricingServer::Connection {
+    int fd = -1;              // non-blocking socket (I/O thread only)
+    std::string buffer;       // bytes received but not yet decoded (I/O thread only)
+
+    // Responses are queued by the pricing threads and sent by the I/O thread, so a
+    // client that stops reading never blocks a pricing thread or the poll loop
+    std::mutex output_mutex;
+    std::string output;       // encoded frames not yet sent
+    bool closed = false;      // set when the I/O thread drops the connection
+};
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    // Responses queued for a client that does not read them: beyond this, it is disconnected
+    const std::size_t MAX_PENDING_OUTPUT = 64u << 20;
+
+    std::uint64_t nanosecondsSince(Clock::time_point start) {
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+    }
+
+    // Requests that can share paths: same model, maturity, seed and path count, no adaptive stop
+    bool isCoalescable(const TradeSpec& trade) {
+        return trade.engine == "mc" && trade.target_error <= 0.0;
+    }
+
+    std::string groupKey(const TradeSpec& trade) {
+        std::ostringstream key;
+        key << std::setprecision(17) << trade.model << '|' << trade.S0 << '|' << trade.sigma << '|'
+            << trade.steps << '|' << trade.r << '|' << trade.T << '|' << trade.seed << '|' << trade.max_paths;
+        for (const auto& parameter : trade.parameters) {
+            key << '|' << parameter.first << '=' << parameter.second;
+        }
+        return key.str();
+    }
+
+#ifdef PRICER_HAS_SOCKETS
+
+    bool setNonBlocking(int fd) {
+        int flags = ::fcntl(fd, F_GETFL, 0);
+        return flags >= 0 && ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+    }
+
+    bool writeAll(int fd, const std::string& data) {
+        std::size_t written = 0;
+        while (written < data.size()) {
+            ssize_t n = ::send(fd, data.data() + written, data.size() - written, MSG_NOSIGNAL);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            written += static_cast<std::size_t>(n);
+        }
+        return true;
+    }
+
+    // Opens a listening (server) or connected (client) socket for "unix:<path>" or "tcp:<port>"
+    int openSocket(const std::string& address, bool listening, std::string* unix_path) {
+
+        int fd = -1;
+        if (address.compare(0, 5, "unix:") == 0) {
+            std::string path = address.substr(5);
+            sockaddr_un addr;
+            std::memset(&addr, 0, sizeof(addr));
+            addr.sun_family = AF_UNIX;
+            if (path.empty() || path.size() >= sizeof(addr.sun_path)) {
+                throw std::runtime_error("Error: invalid Unix socket path '" + path + "'.");
+            }
+            std::strcpy(addr.sun_path, path.c_str());
+
+            fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            if (fd < 0) throw std::runtime_error("Error: cannot create a socket.");
+            if (listening) {
+                ::unlink(path.c_str());
+                if (::bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || ::listen(fd, 128) != 0) {
+                    ::close(fd);
+                    throw std::runtime_error("Error: cannot listen on " + address);
+                }
+                if (unix_path) *unix_path = path;
+            } else if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+                ::close(fd);
+                throw std::runtime_error("Error: cannot connect to " + address);
+            }
+            return fd;
+        }
+
+        if (address.compare(0, 4, "tcp:") == 0) {
+            int port = std::stoi(address.substr(4));
+            sockaddr_in addr;
+            std::memset(&addr, 0, sizeof(addr));
+            addr.sin_family = AF_INET;
+            addr.sin_port = htons(static_cast<std::uint16_t>(port));
+            addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+            fd = ::socket(AF_INET, SOCK_STREAM, 0);
+            if (fd < 0) throw std::runtime_error("Error: cannot create a socket.");
+            int one = 1;
+            if (listening) {
+                ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+                if (::bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || ::listen(fd, 128) != 0) {
+                    ::close(fd);
+                    throw std::runtime_error("Error: cannot listen on " + address);
+                }
+            } else {
+                if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+                    ::close(fd);
+                    throw std::runtime_error("Error: cannot connect to " + address);
+                }
+                // Small request/response messages: do not wait for Nagle coalescing
+                ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+            }
+            return fd;
+        }
+
+        throw std::runtime_error("Error: address must be 'unix:<path>' or 'tcp:<port>'.");
+    }
+
+#endif
+}
+
+PricingServer::PricingServer(const ServerSettings& settings_in)
+    : settings(settings_in), num_requests(0), num_errors(0), num_runs(0),
+      executor(settings_in.num_threads)
+{}
+
+PricingServer::~PricingServer() {
+    stop();
+}
+
+std::string PricingServer::getStatistics() const {
+    std::uint64_t requests = num_requests.load();
+    std::uint64_t runs = num_runs.load();
+
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(2)
+        << "requests=" << requests << " errors=" << num_errors.load() << " pricing_runs=" << runs
+        << " requests_per_run=" << (runs == 0 ? 0.0 : static_cast<double>(requests) / runs)
+        << " threads=" << executor.getThreadCount()
+        << " cache_hits=" << PricingCache::shared().getHits()
+        << " cache_misses=" << PricingCache::shared().getMisses() << "\n"
+        << "latency: " << latency.summary() << "\n"
+        << "queue:   " << queue_latency.summary() << "\n";
+    if (Instrumentation::isEnabled()) {
+        out << Instrumentation::toPrometheus(Instrumentation::globalSnapshot());
+    }
+    return out.str();
+}
+
+void PricingServer::respond(const PendingRequest& request, const TradeResult& result) {
+
+    PricingProtocol::Message message;
+    message.type = PricingProtocol::MessageType::PriceResponse;
+    message.request_id = request.request_id;
+    message.result = result;
+    std::string frame = PricingProtocol::encode(message);
+
+    if (!result.error.empty()) num_errors.fetch_add(1, std::memory_order_relaxed);
+
+    // Queue the frame and wake the I/O thread, which sends it when the socket is writable
+    queueOutput(*request.connection, frame);
+    latency.record(nanosecondsSince(request.received));
+}
+
+void PricingServer::queueOutput(Connection& connection, const std::string& frame) {
+    std::lock_guard<std::mutex> lock(connection.output_mutex);
+    if (connection.closed) return;
+    connection.output += frame;
+#ifdef PRICER_HAS_SOCKETS
+    // Written under the lock: once the I/O thread has closed every connection, nobody
+    // touches the pipe any more. Non-blocking: if it is full, a wake-up is pending anyway
+    char wake = 0;
+    ssize_t ignored = ::write(wake_fds[1], &wake, 1);
+    (void)ignored;
+#endif
+}
+
+void PricingServer::priceGroup(std::vector<PendingRequest>& group) {
+
+    const Clock::time_point start = Clock::now();
+    for (const PendingRequest& request : group) {
+        queue_latency.record(nanosecondsSince(request.received));
+    }
+    num_runs.fetch_add(1, std::memory_order_relaxed);
+
+    // 1. Single request (or not coalescable): the generic trade pricer
+    if (group.size() == 1 && !isCoalescable(group[0].trade)) {
+        respond(group[0], TradePricer::price(group[0].trade));
+        return;
+    }
+
+    // 2. Portfolio run: build every option, simulate the shared paths once
+    std::vector<std::unique_ptr<Option>> options;
+    std::vector<const Option*> portfolio;
+    std::vector<const PendingRequest*> members;
+
+    for (const PendingRequest& request : group) {
+        try {
+            options.push_back(TradePricer::createOption(request.trade));
+            portfolio.push_back(options.back().get());
+            members.push_back(&request);
+        } catch (const std::exception& e) {
+            TradeResult failed;
+            failed.id = request.trade.id;
+            failed.error = e.what();
+            respond(request, failed);
+        }
+    }
+    if (portfolio.empty()) return;
+
+    const TradeSpec& reference = members[0]->trade;
+    std::vector<PricingResult> prices;
+    std::string error;
+    try {
+        std::unique_ptr<AssetModel> model = TradePricer::createModel(reference);
+        RNG::getInstance().seed(reference.seed);
+        prices = MonteCarloPricer::calculatePortfolioPrices(portfolio, *model, reference.max_paths);
+    } catch (const std::exception& e) {
+        error = e.what();
+    }
+
+    // 3. One response per member (the run time is shared)
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    for (std::size_t i = 0; i < members.size(); ++i) {
+        TradeResult result;
+        result.id = members[i]->trade.id;
+        result.seconds = seconds;
+        if (error.empty()) {
+            result.price = prices[i].price;
+            result.standard_error = prices[i].standard_error;
+            result.paths = reference.max_paths;
+        } else {
+            result.error = error;
+        }
+        respond(*members[i], result);
+    }
+}
+
+void PricingServer::dispatch(std::vector<PendingRequest>& requests) {
+
+    // Group the coalescable requests by model key, the others run alone
+    std::map<std::string, std::vector<PendingRequest>> groups;
+    for (PendingRequest& request : requests) {
+        if (isCoalescable(request.trade)) {
+            groups[groupKey(request.trade)].push_back(std::move(request));
+        } else {
+            submitGroup(std::make_shared<std::vector<PendingRequest>>(1, std::move(request)));
+        }
+    }
+    for (auto& entry : groups) {
+        auto group = std::make_shared<std::vector<PendingRequest>>(std::move(entry.second));
+        submitGroup(group);
+    }
+}
+
+void PricingServer::submitGroup(const std::shared_ptr<std::vector<PendingRequest>>& group) {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        ++runs_in_flight;
+    }
+    executor.submit([this, group]() {
+        priceGroup(*group);
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex);
+            --runs_in_flight;
+        }
+        queue_ready.notify_all();
+    });
+}
+
+void PricingServer::dispatchLoop() {
+
+    std::vector<PendingRequest> pending;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex);
+            queue_ready.wait(lock, [this]() { return !running || !queue.empty(); });
+            if (!running) return;
+
+            // Coalescing window: let concurrent requests arrive before grouping them
+            if (settings.coalesce_window_us > 0) {
+                queue_ready.wait_for(lock, std::chrono::microseconds(settings.coalesce_window_us),
+                                     [this]() { return !running; });
+            }
+
+            // While every pricing thread is busy, requests keep accumulating (bigger groups under load)
+            queue_ready.wait(lock, [this]() { return !running || runs_in_flight < executor.getThreadCount(); });
+            if (!running) return;
+            pending.swap(queue);
+        }
+        dispatch(pending);
+        pending.clear();
+    }
+}
+
+#ifdef PRICER_HAS_SOCKETS
+
+void PricingServer::start() {
+
+    if (running) return;
+    listen_fd = openSocket(settings.address, true, &unix_path);
+    if (::pipe(wake_fds) != 0) {
+        ::close(listen_fd);
+        throw std::runtime_error("Error: PricingServer could not create a pipe.");
+    }
+    setNonBlocking(wake_fds[0]);
+    setNonBlocking(wake_fds[1]);
+
+    running = true;
+    dispatch_thread = std::thread(&PricingServer::dispatchLoop, this);
+    io_thread = std::thread(&PricingServer::ioLoop, this);
+}
+
+void PricingServer::stop() {
+
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        if (!running) return;
+        running = false;
+    }
+    queue_ready.notify_all();
+    char wake = 1;
+    ssize_t ignored = ::write(wake_fds[1], &wake, 1);
+    (void)ignored;
+
+    if (io_thread.joinable()) io_thread.join();
+    if (dispatch_thread.joinable()) dispatch_thread.join();
+
+    ::close(listen_fd);
+    ::close(wake_fds[0]);
+    ::close(wake_fds[1]);
+    listen_fd = wake_fds[0] = wake_fds[1] = -1;
+    if (!unix_path.empty()) ::unlink(unix_path.c_str());
+}
+
+void PricingServer::ioLoop() {
+
+    std::vector<std::shared_ptr<Connection>> connections;
+    std::vector<pollfd> pfds;
+    char chunk[65536];
+
+    auto closeConnection = [](Connection& connection) {
+        std::lock_guard<std::mutex> lock(connection.output_mutex);
+        ::close(connection.fd);
+        connection.fd = -1;
+        connection.closed = true;
+        connection.output.clear();
+    };
+
+    // Sends what the socket accepts without blocking; false if the connection is lost
+    auto flushOutput = [](Connection& connection) {
+        std::lock_guard<std::mutex> lock(connection.output_mutex);
+        std::size_t sent = 0;
+        while (sent < connection.output.size()) {
+            ssize_t n = ::send(connection.fd, connection.output.data() + sent,
+                               connection.output.size() - sent, MSG_NOSIGNAL);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+                return false;
+            }
+            sent += static_cast<std::size_t>(n);
+        }
+        connection.output.erase(0, sent);
+        return connection.output.size() <= MAX_PENDING_OUTPUT;
+    };
+
+    while (true) {
+
+        // 1. Wait for the listening socket, the wake-up pipe and every client
+        // (writability only for the clients with queued responses)
+        pfds.assign(2 + connections.size(), pollfd());
+        pfds[0].fd = listen_fd;
+        pfds[1].fd = wake_fds[0];
+        for (std::size_t i = 0; i < connections.size(); ++i) {
+            pfds[2 + i].fd = connections[i]->fd;
+            std::lock_guard<std::mutex> lock(connections[i]->output_mutex);
+            if (!connections[i]->output.empty()) pfds[2 + i].events = POLLOUT;
+        }
+        for (pollfd& pfd : pfds) pfd.events |= POLLIN;
+
+        if (::poll(pfds.data(), pfds.size(), -1) < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+
+        // 2. Wake-up: stop request, or responses queued by the pricing threads
+        if (pfds[1].revents) {
+            while (::read(wake_fds[0], chunk, sizeof(chunk)) > 0) {}
+            std::lock_guard<std::mutex> lock(queue_mutex);
+            if (!running) break;
+        }
+
+        // 3. New connections (non-blocking, like every client socket of the server)
+        if (pfds[0].revents & POLLIN) {
+            int fd = ::accept(listen_fd, nullptr, nullptr);
+            if (fd >= 0) {
+                if (setNonBlocking(fd)) {
+                    auto connection = std::make_shared<Connection>();
+                    connection->fd = fd;
+                    connections.push_back(connection);
+                } else {
+                    ::close(fd);
+                }
+            }
+        }
+
+        // 4. Read and decode the requests of every ready client
+        std::vector<PendingRequest> received;
+        for (std::size_t i = 0; i < connections.size(); ++i) {
+            if (!(pfds[2 + i].revents & (POLLIN | POLLHUP | POLLERR))) continue;
+            Connection& connection = *connections[i];
+
+            ssize_t n = ::read(connection.fd, chunk, sizeof(chunk));
+            if (n < 0 && (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK)) continue;
+            if (n <= 0) {
+                closeConnection(connection);
+                continue;
+            }
+
+            connection.buffer.append(chunk, static_cast<std::size_t>(n));
+            std::size_t offset = 0;
+            PricingProtocol::Message message;
+            try {
+                while (PricingProtocol::decode(connection.buffer, offset, message)) {
+                    if (message.type == PricingProtocol::MessageType::StatsRequest) {
+                        PricingProtocol::Message reply;
+                        reply.type = PricingProtocol::MessageType::StatsResponse;
+                        reply.request_id = message.request_id;
+                        reply.text = getStatistics();
+                        std::lock_guard<std::mutex> lock(connection.output_mutex);
+                        connection.output += PricingProtocol::encode(reply);
+                    } else if (message.type == PricingProtocol::MessageType::PriceRequest) {
+                        PendingRequest request;
+                        request.connection = connections[i];
+                        request.request_id = message.request_id;
+                        request.trade = std::move(message.trade);
+                        request.received = Clock::now();
+                        num_requests.fetch_add(1, std::memory_order_relaxed);
+                        // Same checks as a trade file line: invalid trades never reach the engines
+                        try {
+                            request.trade.validate();
+                        } catch (const std::runtime_error& e) {
+                            TradeResult invalid;
+                            invalid.id = request.trade.id;
+                            invalid.error = std::string("Error: invalid trade: ") + e.what();
+                            respond(request, invalid);
+                            continue;
+                        }
+                        received.push_back(std::move(request));
+                    }
+                }
+                connection.buffer.erase(0, offset);
+            } catch (const std::runtime_error&) {
+                // Garbage on the stream: the client is disconnected
+                closeConnection(connection);
+            }
+        }
+
+        // 5. Send the queued responses (stats replies and prices), as far as the sockets accept
+        for (const std::shared_ptr<Connection>& connection : connections) {
+            if (connection->fd >= 0 && !flushOutput(*connection)) {
+                closeConnection(*connection);
+            }
+        }
+
+        // 6. Hand the requests to the dispatcher and forget the closed connections
+        if (!received.empty()) {
+            std::lock_guard<std::mutex> lock(queue_mutex);
+            for (PendingRequest& request : received) queue.push_back(std::move(request));
+        }
+        if (!received.empty()) queue_ready.notify_one();
+
+        std::vector<std::shared_ptr<Connection>> alive;
+        for (const std::shared_ptr<Connection>& connection : connections) {
+            if (connection->fd >= 0) alive.push_back(connection);
+        }
+        connections.swap(alive);
+    }
+
+    for (const std::shared_ptr<Connection>& connection : connections) {
+        closeConnection(*connection);
+    }
+}
+
+// --- PricingClient ---
+
+PricingClient::PricingClient(const std::string& address) {
+    fd = openSocket(address, false, nullptr);
+}
+
+PricingClient::~PricingClient() {
+    if (fd >= 0) ::close(fd);
+}
+
+PricingProtocol::Message PricingClient::roundTrip(PricingProtocol::Message request) {
+
+    request.request_id = next_id++;
+    if (!writeAll(fd, PricingProtocol::encode(request))) {
+        throw std::runtime_error("Error: connection to the pricing server lost.");
+    }
+
+    char chunk[65536];
+    PricingProtocol::Message reply;
+    while (true) {
+        std::size_t offset = 0;
+        if (PricingProtocol::decode(buffer, offset, reply)) {
+            buffer.erase(0, offset);
+            if (reply.request_id == request.request_id) return reply;
+            continue;
+        }
+        ssize_t n = ::read(fd, chunk, sizeof(chunk));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) {
+            throw std::runtime_error("Error: connection to the pricing server lost.");
+        }
+        buffer.append(chunk, static_cast<std::size_t>(n));
+    }
+}
+
+#else
+
+void PricingServer::start() {
+    throw std::runtime_error("Error: PricingServer requires a POSIX system (sockets).");
+}
+
+void PricingServer::stop() {}
+
+void PricingServer::ioLoop() {}
+
+PricingClient::PricingClient(const std::string&) {
+    throw std::runtime_error("Error: PricingClient requires a POSIX system (sockets).");
+}
+
+PricingClient::~PricingClient() {}
+
+PricingProtocol::Message PricingClient::roundTrip(PricingProtocol::Message) {
+    throw std::runtime_error("Error: PricingClient requires a POSIX system (sockets).");
+}
+
+#endif
+
+TradeResult PricingClient::price(const TradeSpec& trade) {
+    PricingProtocol::Message request;
+    request.type = PricingProtocol::MessageType::PriceRequest;
+    request.trade = trade;
+    return roundTrip(request).result;
+}
+
+std::string PricingClient::getServerStatistics() {
+    PricingProtocol::Message request;
+    request.type = PricingProtocol::MessageType::StatsRequest;
+    return roundTrip(request).text;
+}
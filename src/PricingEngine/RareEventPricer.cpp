@@ -0,0 +1,206 @@
+#include "PricingEngine/RareEventPricer.hpp"
+#include "Core/PathArena.hpp"
+#include "Models/RNG.hpp"
+#include "Utils/BlackScholesFormulas.hpp"
+#include "Utils/Instrumentation.hpp"
+#include "Utils/VectorMath.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+    // Number of paths built together (same block size as MonteCarloPricer)
+    const int SIMULATION_BLOCK = 256;
+
+    // Search range and grid of the optimal shift (standardized terminal value)
+    const double SHIFT_RANGE = 8.0;
+    const double SHIFT_GRID_STEP = 0.05;
+    const int GOLDEN_ITERATIONS = 60;
+}
+
+RareEventPricer::RareEventPricer(const Option& option_in, const GBM& model_in)
+    : option(option_in), model(model_in)
+{}
+
+void RareEventPricer::meanPath(double xi, Path& out) const {
+
+    const int steps = model.getSteps();
+    const double T = option.getT();
+    const double sigma = model.getSigma();
+    const double drift = model.getMu() - 0.5 * sigma * sigma;
+
+    out.setView(nullptr, 0, 1);
+    std::vector<double>& prices = out.data();
+    prices.resize(static_cast<std::size_t>(steps) + 1);
+
+    // E[W_t | W_T] = (t / T) * W_T: the log-price is linear in t
+    for (int t = 0; t <= steps; ++t) {
+        const double time = T * t / steps;
+        prices[t] = model.getS0() * std::exp(drift * time + sigma * (time / T) * std::sqrt(T) * xi);
+    }
+}
+
+double RareEventPricer::findOptimalShift() const {
+
+    Path path;
+    auto objective = [&](double xi) {
+        meanPath(xi, path);
+        const double payoff = option.payoff(path);
+        return (payoff > 0.0) ? std::log(payoff) - 0.5 * xi * xi : -HUGE_VAL;
+    };
+
+    // 1. Grid search of the maximum
+    double best_xi = 0.0;
+    double best_value = -HUGE_VAL;
+    for (double xi = -SHIFT_RANGE; xi <= SHIFT_RANGE + 1e-12; xi += SHIFT_GRID_STEP) {
+        const double value = objective(xi);
+        if (value > best_value) {
+            best_value = value;
+            best_xi = xi;
+        }
+    }
+    if (best_value == -HUGE_VAL) return 0.0;
+
+    // 2. Golden-section refinement around the best grid point
+    const double ratio = 0.5 * (std::sqrt(5.0) - 1.0);
+    double a = best_xi - SHIFT_GRID_STEP;
+    double b = best_xi + SHIFT_GRID_STEP;
+    double c = b - ratio * (b - a);
+    double d = a + ratio * (b - a);
+    double fc = objective(c);
+    double fd = objective(d);
+    for (int i = 0; i < GOLDEN_ITERATIONS; ++i) {
+        if (fc > fd) {
+            b = d; d = c; fd = fc;
+            c = b - ratio * (b - a);
+            fc = objective(c);
+        } else {
+            a = c; c = d; fc = fd;
+            d = a + ratio * (b - a);
+            fd = objective(d);
+        }
+    }
+    const double refined = 0.5 * (a + b);
+    return (objective(refined) >= best_value) ? refined : best_xi;
+}
+
+RareEventResult RareEventPricer::calculatePrice(int num_simulations, const RareEventSettings& settings) const {
+
+    const int K = settings.strata;
+    if (K < 1 || num_simulations < 2 * K) {
+        throw std::invalid_argument("Error: RareEventPricer requires strata >= 1 and at least 2 paths per stratum.");
+    }
+
+    // 1. Shift of the terminal normal
+    double theta = 0.0;
+    if (settings.importance_sampling) {
+        theta = std::isnan(settings.shift) ? findOptimalShift() : settings.shift;
+    }
+
+    const int steps = model.getSteps();
+    const double T = option.getT();
+    const double dt = T / steps;
+    const double sigma = model.getSigma();
+    const double drift = model.getMu() - 0.5 * sigma * sigma;
+    const double S0 = model.getS0();
+    const double sqrt_T = std::sqrt(T);
+
+    std::vector<PayoffStatistics> stratum_stats(static_cast<std::size_t>(K));
+    std::size_t hits = 0;
+
+    PathBatch batch;
+    Path path;
+    double weights[SIMULATION_BLOCK];
+    int strata_of[SIMULATION_BLOCK];
+    PathArena& arena = PathArena::forThread();
+    const std::size_t length = static_cast<std::size_t>(steps) + 1;
+    RNG& rng = RNG::getInstance();
+
+    for (int done = 0; done < num_simulations; done += SIMULATION_BLOCK) {
+
+        const int block = std::min(SIMULATION_BLOCK, num_simulations - done);
+        const std::size_t n = static_cast<std::size_t>(block);
+        batch.resize(n, steps);
+
+        // Workspace: W_t, terminal W_T, bridge draws / exponent arguments
+        double* W = batch.getWorkspace(3);
+        double* W_T = W + n;
+        double* Z = W + 2 * n;
+
+        // A. Terminal values: stratified uniform, inverse CDF, shift and likelihood ratio
+        {
+            PRICER_TIME_SCOPE(RandomNumbers);
+            for (int p = 0; p < block; ++p) {
+                const int k = (done + p) % K;
+                const double z = BlackScholesFormulas::N_inv((k + rng.getUniform()) / K);
+                const double xi = theta + z;
+                strata_of[p] = k;
+                weights[p] = std::exp(-theta * z - 0.5 * theta * theta);
+                W_T[p] = sqrt_T * xi;
+            }
+        }
+
+        // B. Brownian bridge from W_0 = 0 to W_T, one row of paths per step
+        {
+            PRICER_TIME_SCOPE(PathConstruction);
+            std::fill(W, W + n, 0.0);
+            std::fill(batch.row(0), batch.row(0) + n, S0);
+            for (int t = 0; t < steps; ++t) {
+                if (t + 1 == steps) {
+                    std::copy(W_T, W_T + n, W);
+                } else {
+                    // W_{t+1} | W_t, W_T ~ N(W_t + (W_T - W_t) dt / tau, dt (tau - dt) / tau), tau = T - t dt
+                    const double tau = T - t * dt;
+                    const double fraction = dt / tau;
+                    const double deviation = std::sqrt(dt * (tau - dt) / tau);
+                    rng.fillStandardNormal(Z, n);
+                    for (std::size_t p = 0; p < n; ++p) {
+                        W[p] += (W_T[p] - W[p]) * fraction + deviation * Z[p];
+                    }
+                }
+                const double time = (t + 1) * dt;
+                for (std::size_t p = 0; p < n; ++p) {
+                    Z[p] = drift * time + sigma * W[p];
+                }
+                double* next = batch.row(t + 1);
+                VectorMath::exp(Z, next, n);
+                for (std::size_t p = 0; p < n; ++p) {
+                    next[p] *= S0;
+                }
+            }
+        }
+
+        // C. Weighted payoffs, accumulated per stratum
+        {
+            PRICER_TIME_SCOPE(Payoff);
+            PathArena::Scope scope(arena);
+            double* paths = arena.allocate(n * length);
+            batch.copyPathMajor(paths);
+            for (int p = 0; p < block; ++p) {
+                path.setView(paths + static_cast<std::size_t>(p) * length, length, 1);
+                const double payoff = option.payoff(path);
+                if (payoff != 0.0) ++hits;
+                stratum_stats[strata_of[p]].add(payoff * weights[p]);
+            }
+        }
+        PRICER_COUNT(Paths, block);
+    }
+
+    // 2. Stratified estimator: equal stratum probabilities 1 / K
+    double mean = 0.0;
+    double variance = 0.0;
+    for (const PayoffStatistics& stats : stratum_stats) {
+        mean += stats.getMean() / K;
+        variance += stats.getVariance() / (static_cast<double>(stats.getCount()) * K * K);
+    }
+
+    const double df = option.getDiscountFactor();
+    RareEventResult result(df * mean, df * std::sqrt(variance));
+    result.discount_factor = df;
+    result.shift = theta;
+    result.strata = K;
+    result.hit_ratio = static_cast<double>(hits) / num_simulations;
+    return result;
+}
@@ -0,0 +1,119 @@
+#include "PricingEngine/RepricingSession.hpp"
+#include "Models/RNG.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    // Paths generated together when filling the cache (same block size as MonteCarloPricer)
+    const int SIMULATION_BLOCK = 256;
+}
+
+RepricingSession::RepricingSession(const Option& option_in, const GBM& model_in, int num_paths_in, std::uint64_t seed)
+    : option(option_in), num_paths(num_paths_in), steps(model_in.getSteps()),
+      mu(model_in.getMu()), sigma(model_in.getSigma()), dt(option_in.getT() / model_in.getSteps())
+{
+    if (num_paths <= 0) {
+        throw std::invalid_argument("Error: a RepricingSession requires a positive number of paths.");
+    }
+
+    const std::size_t length = static_cast<std::size_t>(steps) + 1;
+    normalized.resize(static_cast<std::size_t>(num_paths) * length);
+    sum_log.resize(num_paths);
+    sum_log_sq.resize(num_paths);
+
+    // 1. Normalized model (S0 = 1) and a fixed random stream
+    GBM unit_model(1.0, steps, mu, sigma);
+    RNG::getInstance().seed(seed);
+
+    PathBatch batch;
+    for (int done = 0; done < num_paths; done += SIMULATION_BLOCK) {
+        int block = std::min(SIMULATION_BLOCK, num_paths - done);
+        batch.resize(static_cast<std::size_t>(block), steps);
+        unit_model.generatePathBatch(option.getT(), batch);
+
+        // 2. Store path-major (one contiguous row per path) with its log-increment sums
+        for (int b = 0; b < block; ++b) {
+            std::size_t p = static_cast<std::size_t>(done + b);
+            double* row = normalized.data() + p * length;
+            double s1 = 0.0, s2 = 0.0;
+            for (int t = 0; t <= steps; ++t) {
+                row[t] = batch.row(t)[b];
+                if (t > 0) {
+                    double x = std::log(row[t] / row[t - 1]);
+                    s1 += x;
+                    s2 += x * x;
+                }
+            }
+            sum_log[p] = s1;
+            sum_log_sq[p] = s2;
+        }
+    }
+}
+
+double RepricingSession::weight(std::size_t p, double sigma_new) const {
+    // Log-increments are i.i.d. N(m dt, s^2 dt) with m = mu - s^2/2:
+    // log LR = n log(sigma / sigma_new) - Q(sigma_new) + Q(sigma),
+    // Q(s) = sum (x - m dt)^2 / (2 s^2 dt), expanded with sum x and sum x^2
+    auto quadratic = [&](double s) {
+        double m = (mu - 0.5 * s * s) * dt;
+        return (sum_log_sq[p] - 2.0 * m * sum_log[p] + steps * m * m) / (2.0 * s * s * dt);
+    };
+    double log_ratio = steps * std::log(sigma / sigma_new) - quadratic(sigma_new) + quadratic(sigma);
+    return std::exp(log_ratio);
+}
+
+PricingResult RepricingSession::evaluate(double S0, const double* sigma_new) const {
+
+    const std::size_t length = static_cast<std::size_t>(steps) + 1;
+    PayoffStatistics stats;
+    Path path{std::vector<double>(length)};
+    std::vector<double>& prices = path.data();
+
+    // Rescale each cached path in place of one reused Path, then evaluate the payoff
+    for (std::size_t p = 0; p < static_cast<std::size_t>(num_paths); ++p) {
+        const double* row = normalized.data() + p * length;
+        for (std::size_t t = 0; t < length; ++t) {
+            prices[t] = S0 * row[t];
+        }
+        double payoff = option.payoff(path);
+        stats.add(sigma_new ? payoff * weight(p, *sigma_new) : payoff);
+    }
+
+    return PricingResult(stats, option.getDiscountFactor());
+}
+
+PricingResult RepricingSession::price(double S0) const {
+    return evaluate(S0, nullptr);
+}
+
+PricingResult RepricingSession::price(double S0, double sigma_new) const {
+    if (sigma_new <= 0.0) {
+        throw std::invalid_argument("Error: the volatility must be positive.");
+    }
+    if (sigma_new == sigma) {
+        return evaluate(S0, nullptr);
+    }
+    return evaluate(S0, &sigma_new);
+}
+
+GreeksResult RepricingSession::calculateDeltaGamma(double S0, double epsilon) const {
+    double V_plus = price(S0 + epsilon).price;
+    double V_0 = price(S0).price;
+    double V_minus = price(S0 - epsilon).price;
+
+    GreeksResult result;
+    result.delta = (V_plus - V_minus) / (2.0 * epsilon);
+    result.gamma = (V_plus - 2.0 * V_0 + V_minus) / (epsilon * epsilon);
+    return result;
+}
+
+double RepricingSession::getEffectiveSampleSize(double sigma_new) const {
+    double sum_w = 0.0, sum_w2 = 0.0;
+    for (std::size_t p = 0; p < static_cast<std::size_t>(num_paths); ++p) {
+        double w = weight(p, sigma_new);
+        sum_w += w;
+        sum_w2 += w * w;
+    }
+    return (sum_w2 > 0.0) ? sum_w * sum_w / sum_w2 : 0.0;
+}
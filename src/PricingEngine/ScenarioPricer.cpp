@@ -0,0 +1,50 @@
+#include "PricingEngine/ScenarioPricer.hpp"
+#include "Core/PathArena.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+ScenarioPricer::ScenarioPricer(const Option& option_in, const ScenarioFile& scenarios_in)
+    : option(option_in), scenarios(scenarios_in)
+{}
+
+PricingResult ScenarioPricer::calculatePrice(std::uint64_t max_paths) const {
+
+    const ScenarioHeader& header = scenarios.getHeader();
+    if (std::abs(option.getT() - header.maturity) > 1e-12 * std::max(1.0, header.maturity)) {
+        throw std::invalid_argument("Error: the option maturity differs from the scenario horizon.");
+    }
+
+    std::uint64_t remaining = (max_paths == 0) ? header.num_paths : std::min(max_paths, header.num_paths);
+
+    PayoffStatistics stats;
+    QuantileSketch quantiles;
+    Path path;
+    PathArena& arena = PathArena::forThread();
+    const std::size_t length = header.num_assets * (static_cast<std::size_t>(header.steps) + 1);
+
+    // 1. Block by block: a path-major copy of the mapped rows in the thread arena,
+    // then every payoff through views over that copy (no allocation, no strided gather)
+    for (std::size_t b = 0; b < scenarios.getNumBlocks() && remaining > 0; ++b) {
+        const std::size_t stored = scenarios.getBlockPaths(b);
+        const std::size_t block = static_cast<std::size_t>(std::min<std::uint64_t>(stored, remaining));
+
+        PathArena::Scope scope(arena);
+        double* paths = arena.allocate(stored * length);
+        double* payoffs = arena.allocate(block);
+        scenarios.copyPathMajor(b, paths);
+        for (std::size_t p = 0; p < block; ++p) {
+            path.setView(paths + p * length, length, header.num_assets);
+            payoffs[p] = option.payoff(path);
+        }
+        stats.add(payoffs, block);
+        quantiles.add(payoffs, block);
+        remaining -= block;
+    }
+
+    // 2. Discounting and standard error
+    PricingResult result(stats, option.getDiscountFactor());
+    quantiles.flush();
+    result.quantiles = std::move(quantiles);
+    return result;
+}
@@ -0,0 +1,307 @@
+#include "PricingEngine/ShardedPricer.hpp"
+#include "Models/RNG.hpp"
+#include "PricingEngine/MonteCarloPricer.hpp"
+#include "Utils/BinaryIO.hpp"
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define PRICER_HAS_FORK 1
+    #include <cerrno>
+    #include <poll.h>
+    #include <signal.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+    #if defined(__linux__)
+        #include <dirent.h>
+        #include <sched.h>
+    #endif
+#endif
+
+ShardedPricer::ShardedPricer(const Option& option_in, const AssetModel& model_in)
+    : option(option_in), model(model_in)
+{}
+
+PricingResult ShardedPricer::simulateBatch(int num_paths, const ShardSettings& settings,
+                                           std::uint64_t batch_index) const {
+    RNG::getInstance().seed(settings.seed, batch_index);
+
+    PayoffStatistics stats;
+    QuantileSketch quantiles;
+    MonteCarloPricer pricer(option, model);
+    pricer.setSampling(settings.sampling);
+    pricer.accumulatePayoffs(num_paths, stats, nullptr, settings.keep_quantiles ? &quantiles : nullptr);
+    PricingResult result(stats, model.getDiscountFactor(option.getT(), option.getR()));
+    result.paths_per_sample = settings.sampling.antithetic ? 2 : 1;
+    quantiles.flush();
+    result.quantiles = std::move(quantiles);
+    return result;
+}
+
+#ifdef PRICER_HAS_FORK
+
+namespace {
+
+    struct Worker {
+        pid_t pid = -1;
+        int fd = -1;
+        std::string buffer;   // bytes received but not yet decoded
+    };
+
+    // Writes the whole buffer, retrying on partial writes and interrupts.
+    bool writeAll(int fd, const std::string& data) {
+        size_t written = 0;
+        while (written < data.size()) {
+            ssize_t n = ::write(fd, data.data() + written, data.size() - written);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            written += static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    // Frame = u32 payload length, then payload = u64 batch index + serialized PricingResult.
+    std::string encodeFrame(std::uint64_t batch_index, const PricingResult& result) {
+        std::ostringstream payload(std::ios::binary);
+        BinaryIO::writeU64(payload, batch_index);
+        result.writeBinary(payload);
+
+        std::ostringstream frame(std::ios::binary);
+        BinaryIO::writeU32(frame, static_cast<std::uint32_t>(payload.str().size()));
+        frame << payload.str();
+        return frame.str();
+    }
+
+    // Number of threads of the calling process, or 0 if the platform cannot tell.
+    size_t countProcessThreads() {
+#if defined(__linux__)
+        DIR* dir = ::opendir("/proc/self/task");
+        if (!dir) return 0;
+        size_t count = 0;
+        while (const dirent* entry = ::readdir(dir)) {
+            if (entry->d_name[0] != '.') ++count;
+        }
+        ::closedir(dir);
+        return count;
+#else
+        return 0;
+#endif
+    }
+
+    // CPUs the process is allowed to run on, in increasing order.
+    std::vector<int> allowedCpus() {
+        std::vector<int> cpus;
+#if defined(__linux__)
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+        if (::sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                if (CPU_ISSET(cpu, &mask)) cpus.push_back(cpu);
+            }
+        }
+#endif
+        if (cpus.empty()) {
+            long online = ::sysconf(_SC_NPROCESSORS_ONLN);
+            for (long cpu = 0; cpu < std::max(online, 1L); ++cpu) cpus.push_back(static_cast<int>(cpu));
+        }
+        return cpus;
+    }
+
+    // Stops and reaps the workers already started when the spawn phase fails.
+    void abortWorkers(std::vector<Worker>& workers) {
+        for (Worker& worker : workers) {
+            ::close(worker.fd);
+            ::kill(worker.pid, SIGTERM);
+            while (::waitpid(worker.pid, nullptr, 0) < 0 && errno == EINTR) {}
+        }
+        workers.clear();
+    }
+}
+
+PricingResult ShardedPricer::calculatePrice(long long num_simulations, const ShardSettings& settings) const {
+
+    if (num_simulations <= 0 || settings.batch_size <= 0) {
+        throw std::invalid_argument("Error: ShardedPricer requires num_simulations > 0 and batch_size > 0.");
+    }
+
+    // fork() only duplicates the calling thread: a lock held by another thread would stay locked in the child
+    if (countProcessThreads() > 1) {
+        throw std::runtime_error("Error: ShardedPricer must be called from a single-threaded process.");
+    }
+
+    // 1. Cut the run into batches and give each worker a contiguous range of batches
+    const long long num_batches = (num_simulations + settings.batch_size - 1) / settings.batch_size;
+
+    const std::vector<int> cpus = allowedCpus();
+    long long num_workers = (settings.num_workers > 0) ? settings.num_workers
+                                                       : static_cast<long long>(cpus.size());
+    num_workers = std::min(num_workers, num_batches);
+
+    auto batchSize = [&](long long batch) {
+        long long first_path = batch * settings.batch_size;
+        return static_cast<int>(std::min<long long>(settings.batch_size, num_simulations - first_path));
+    };
+
+    // Avoid duplicated output buffers in the children
+    std::cout.flush();
+    std::cerr.flush();
+
+    // 2. Spawn the workers
+    std::vector<Worker> workers;
+    for (long long w = 0; w < num_workers; ++w) {
+
+        long long first_batch = w * num_batches / num_workers;
+        long long last_batch = (w + 1) * num_batches / num_workers;
+
+        int fds[2];
+        if (::pipe(fds) != 0) {
+            abortWorkers(workers);
+            throw std::runtime_error("Error: ShardedPricer could not create a pipe.");
+        }
+
+        pid_t pid = ::fork();
+        if (pid < 0) {
+            ::close(fds[0]);
+            ::close(fds[1]);
+            abortWorkers(workers);
+            throw std::runtime_error("Error: ShardedPricer could not fork a worker.");
+        }
+
+        if (pid == 0) {
+            // --- Worker process ---
+            ::close(fds[0]);
+            for (const Worker& other : workers) ::close(other.fd);
+
+#if defined(__linux__)
+            if (settings.pin_workers) {
+                cpu_set_t mask;
+                CPU_ZERO(&mask);
+                CPU_SET(cpus[static_cast<size_t>(w) % cpus.size()], &mask);
+                ::sched_setaffinity(0, sizeof(mask), &mask);
+            }
+#endif
+            int status = 0;
+            try {
+                for (long long batch = first_batch; batch < last_batch; ++batch) {
+                    PricingResult summary = simulateBatch(batchSize(batch), settings,
+                                                          static_cast<std::uint64_t>(batch));
+                    if (!writeAll(fds[1], encodeFrame(static_cast<std::uint64_t>(batch), summary))) {
+                        status = 1;
+                        break;
+                    }
+                }
+            } catch (...) {
+                status = 1;
+            }
+            ::close(fds[1]);
+            ::_exit(status);
+        }
+
+        // --- Coordinator ---
+        ::close(fds[1]);
+        Worker worker;
+        worker.pid = pid;
+        worker.fd = fds[0];
+        workers.push_back(worker);
+    }
+
+    // 3. Collect the batch summaries as they are streamed back
+    const double discount_factor = model.getDiscountFactor(option.getT(), option.getR());
+    std::vector<PricingResult> batch_results(static_cast<size_t>(num_batches),
+                                             PricingResult(PayoffStatistics(), discount_factor));
+    std::vector<bool> received(static_cast<size_t>(num_batches), false);
+    bool protocol_error = false;
+
+    size_t open_pipes = workers.size();
+    std::vector<pollfd> pfds(workers.size());
+    char chunk[65536];
+
+    while (open_pipes > 0) {
+
+        for (size_t i = 0; i < workers.size(); ++i) {
+            pfds[i].fd = workers[i].fd;
+            pfds[i].events = POLLIN;
+            pfds[i].revents = 0;
+        }
+
+        if (::poll(pfds.data(), pfds.size(), -1) < 0) {
+            if (errno == EINTR) continue;
+            protocol_error = true;
+            break;
+        }
+
+        for (size_t i = 0; i < workers.size(); ++i) {
+            if (workers[i].fd < 0 || !(pfds[i].revents & (POLLIN | POLLHUP | POLLERR))) continue;
+
+            ssize_t n = ::read(workers[i].fd, chunk, sizeof(chunk));
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) {
+                ::close(workers[i].fd);
+                workers[i].fd = -1;
+                --open_pipes;
+                continue;
+            }
+
+            // Decode every complete frame available for this worker
+            std::string& buffer = workers[i].buffer;
+            buffer.append(chunk, static_cast<size_t>(n));
+            size_t offset = 0;
+            while (buffer.size() - offset >= 4) {
+                std::istringstream header(buffer.substr(offset, 4), std::ios::binary);
+                std::uint32_t length = BinaryIO::readU32(header);
+                if (buffer.size() - offset - 4 < length) break;
+
+                std::istringstream payload(buffer.substr(offset + 4, length), std::ios::binary);
+                try {
+                    std::uint64_t batch = BinaryIO::readU64(payload);
+                    PricingResult summary = PricingResult::readBinary(payload);
+                    if (batch < received.size() && !received[batch]) {
+                        batch_results[batch] = std::move(summary);
+                        received[batch] = true;
+                    } else {
+                        protocol_error = true;
+                    }
+                } catch (const std::runtime_error&) {
+                    protocol_error = true;
+                }
+                offset += 4 + length;
+            }
+            buffer.erase(0, offset);
+        }
+    }
+
+    // 4. Reap the workers
+    bool worker_failed = false;
+    for (Worker& worker : workers) {
+        if (worker.fd >= 0) ::close(worker.fd);
+        int status = 0;
+        while (::waitpid(worker.pid, &status, 0) < 0 && errno == EINTR) {}
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) worker_failed = true;
+    }
+
+    if (worker_failed || protocol_error
+        || std::find(received.begin(), received.end(), false) != received.end()) {
+        throw std::runtime_error("Error: ShardedPricer lost one or more worker batches.");
+    }
+
+    // 5. Merge in batch order so that the result does not depend on the arrival order
+    PricingResult total(PayoffStatistics(), discount_factor);
+    for (const PricingResult& summary : batch_results) {
+        total.merge(summary);
+    }
+    return total;
+}
+
+#else
+
+PricingResult ShardedPricer::calculatePrice(long long, const ShardSettings&) const {
+    throw std::runtime_error("Error: ShardedPricer requires a POSIX system (fork/pipe).");
+}
+
+#endif
@@ -0,0 +1,201 @@
+#include "PricingEngine/TradePricer.hpp"
+#include "PricingEngine/MonteCarloPricer.hpp"
+#include "PricingEngine/FourierPricer.hpp"
+#include "PricingEngine/EDPSolver.hpp"
+#include "PricingEngine/LatticePricer.hpp"
+#include "PricingEngine/PricingCache.hpp"
+#include "PricingEngine/RareEventPricer.hpp"
+#include "Options/EuropeanCall.hpp"
+#include "Options/EuropeanPut.hpp"
+#include "Options/EuropeanBullCallSpread.hpp"
+#include "Options/EuropeanButterFly.hpp"
+#include "Options/AsianOption.hpp"
+#include "Models/GBM.hpp"
+#include "Models/Heston.hpp"
+#include "Models/Merton.hpp"
+#include "Models/RNG.hpp"
+#include "Utils/BlackScholesFormulas.hpp"
+#include "Utils/MertonFormulas.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+    // Explicit EDP grid: M space steps, N time steps large enough for stability
+    const int EDP_SPACE_STEPS = 200;
+
+    void requireStrikes(const TradeSpec& trade, std::size_t count) {
+        if (trade.strikes.size() != count) {
+            throw std::invalid_argument("Error: option type '" + trade.option_type + "' requires "
+                                        + std::to_string(count) + " strike(s).");
+        }
+    }
+
+    // Closed-form prices, as combinations of calls and puts
+    double analyticPrice(const TradeSpec& trade, const Option& option, const AssetModel& model) {
+
+        if (const Merton* merton = dynamic_cast<const Merton*>(&model)) {
+            return MertonFormulas::price(option, *merton);
+        }
+        if (!dynamic_cast<const GBM*>(&model)) {
+            throw std::invalid_argument("Error: no analytic formula for model '" + trade.model + "'.");
+        }
+
+        const std::vector<double>& K = trade.strikes;
+        auto call = [&](double strike) {
+            return BlackScholesFormulas::callPrice(trade.S0, strike, trade.T, trade.r, trade.sigma);
+        };
+
+        if (trade.option_type == "call") return call(K[0]);
+        if (trade.option_type == "put") {
+            return BlackScholesFormulas::putPrice(trade.S0, K[0], trade.T, trade.r, trade.sigma);
+        }
+        if (trade.option_type == "callspread") return call(K[0]) - call(K[1]);
+        if (trade.option_type == "butterfly") return call(K[0]) - 2.0 * call(K[1]) + call(K[2]);
+        throw std::invalid_argument("Error: no analytic formula for option type '" + trade.option_type + "'.");
+    }
+
+    const GBM& requireGBM(const TradeSpec& trade, const AssetModel& model) {
+        const GBM* gbm = dynamic_cast<const GBM*>(&model);
+        if (!gbm) {
+            throw std::invalid_argument("Error: engine '" + trade.engine + "' requires the GBM model.");
+        }
+        return *gbm;
+    }
+}
+
+std::unique_ptr<Option> TradePricer::createOption(const TradeSpec& trade) {
+
+    const std::string& type = trade.option_type;
+
+    if (type == "call") {
+        requireStrikes(trade, 1);
+        return std::make_unique<EuropeanCall>(trade.T, trade.r, trade.strikes[0]);
+    }
+    if (type == "put") {
+        requireStrikes(trade, 1);
+        return std::make_unique<EuropeanPut>(trade.T, trade.r, trade.strikes[0]);
+    }
+    if (type == "callspread") {
+        requireStrikes(trade, 2);
+        return std::make_unique<CallSpread>(trade.T, trade.r, trade.strikes[0], trade.strikes[1]);
+    }
+    if (type == "butterfly") {
+        requireStrikes(trade, 3);
+        return std::make_unique<EuropeanButterFly>(trade.T, trade.r, trade.strikes[0], trade.strikes[1], trade.strikes[2]);
+    }
+    if (type == "asian") {
+        requireStrikes(trade, 1);
+        return std::make_unique<AsianOption>(trade.T, trade.r, trade.strikes[0]);
+    }
+    throw std::invalid_argument("Error: unknown option type '" + type + "'.");
+}
+
+std::unique_ptr<AssetModel> TradePricer::createModel(const TradeSpec& trade) {
+
+    if (trade.model == "gbm") {
+        return std::make_unique<GBM>(trade.S0, trade.steps, trade.r, trade.sigma);
+    }
+    if (trade.model == "heston") {
+        double v0 = trade.parameter("v0", trade.sigma * trade.sigma);
+        return std::make_unique<Heston>(trade.S0, trade.steps, trade.r, v0,
+                                        trade.parameter("kappa", 2.0), trade.parameter("theta", v0),
+                                        trade.parameter("xi", 0.3), trade.parameter("rho", -0.7));
+    }
+    if (trade.model == "merton") {
+        return std::make_unique<Merton>(trade.S0, trade.steps, trade.r, trade.sigma,
+                                        trade.parameter("lambda", 0.0), trade.parameter("jump_mean", 0.0),
+                                        trade.parameter("jump_vol", 0.0));
+    }
+    throw std::invalid_argument("Error: unknown model '" + trade.model + "'.");
+}
+
+TradeResult TradePricer::price(const TradeSpec& trade) {
+
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point start = Clock::now();
+
+    TradeResult result;
+    result.id = trade.id;
+    if (!trade.error.empty()) {
+        result.error = trade.error;
+        return result;
+    }
+
+    try {
+        std::unique_ptr<Option> option = createOption(trade);
+        std::unique_ptr<AssetModel> model = createModel(trade);
+
+        if (trade.engine == "mc") {
+            // Adaptive run: the target error stops it early, max_paths bounds it
+            AdaptiveSettings settings;
+            settings.target_absolute_error = trade.target_error;
+            settings.max_paths = trade.max_paths;
+            settings.batch_size = std::min(trade.max_paths, 10000);
+            PricingKey key("mc-adaptive", *option, *model, {trade.target_error, static_cast<double>(trade.max_paths),
+                                                            static_cast<double>(trade.seed)});
+            PricingResult res = PricingCache::shared().getOrCompute(key, [&]() -> PricingResult {
+                RNG::getInstance().seed(trade.seed);
+                AdaptivePricingResult adaptive = MonteCarloPricer(*option, *model).calculatePriceAdaptive(settings);
+                return PricingResult(adaptive.statistics, adaptive.discount_factor);
+            });
+            result.price = res.price;
+            result.standard_error = res.standard_error;
+            result.paths = static_cast<long long>(res.getPathCount());
+        }
+        else if (trade.engine == "mc-is") {
+            // Far out-of-the-money strikes: stratified terminal value and optimal drift shift
+            const GBM& gbm = requireGBM(trade, *model);
+            RareEventSettings settings;
+            settings.strata = static_cast<int>(trade.parameter("strata", 64.0));
+            settings.shift = trade.parameter("shift", std::numeric_limits<double>::quiet_NaN());
+            RNG::getInstance().seed(trade.seed);
+            RareEventResult res = RareEventPricer(*option, gbm).calculatePrice(trade.max_paths, settings);
+            result.price = res.price;
+            result.standard_error = res.standard_error;
+            result.paths = trade.max_paths;
+        }
+        else if (trade.engine == "analytic") {
+            PricingKey key("analytic", *option, *model);
+            result.price = PricingCache::shared().getOrCompute(key, [&]() {
+                return PricingResult(analyticPrice(trade, *option, *model), 0.0, {});
+            }).price;
+        }
+        else if (trade.engine == "fourier") {
+            result.price = FourierPricer(*model).price(*option);
+        }
+        else if (trade.engine == "edp") {
+            const GBM& gbm = requireGBM(trade, *model);
+            double K_max = *std::max_element(trade.strikes.begin(), trade.strikes.end());
+            // S_max is adjusted so that S0 falls on a node (the solver reads the nearest node)
+            double S_max = 3.0 * std::max(trade.S0, K_max);
+            double s0_node = std::max(1.0, std::round(EDP_SPACE_STEPS * trade.S0 / S_max));
+            S_max = trade.S0 * EDP_SPACE_STEPS / s0_node;
+            int N = std::max(2000, static_cast<int>(2.0 * trade.T * trade.sigma * trade.sigma
+                                                    * EDP_SPACE_STEPS * EDP_SPACE_STEPS) + 1);
+            result.price = PricingCache::shared().priceEDP(*option, gbm, S_max, EDP_SPACE_STEPS, N);
+        }
+        else if (trade.engine == "lattice") {
+            const GBM& gbm = requireGBM(trade, *model);
+            LatticeSettings settings;
+            settings.type = LatticeType::LeisenReimer;
+            settings.richardson = true;
+            if (trade.parameter("american", 0.0) != 0.0) {
+                settings.exercise = ExerciseStyle::American;
+            }
+            int tree_steps = static_cast<int>(trade.parameter("tree_steps", 1000.0));
+            result.price = LatticePricer(*option, gbm).calculatePrice(tree_steps, settings);
+        }
+        else {
+            throw std::invalid_argument("Error: unknown engine '" + trade.engine + "'.");
+        }
+    } catch (const std::exception& e) {
+        result.error = e.what();
+    }
+
+    result.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return result;
+}
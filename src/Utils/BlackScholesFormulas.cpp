@@ -23,6 +23,50 @@ namespace BlackScholesFormulas {
         return 0.5 * (1.0 + std::erf(x / std::sqrt(2.0)));
     }
 
+    double N_inv(double p) {
+        if (p <= 0.0) return -HUGE_VAL;
+        if (p >= 1.0) return HUGE_VAL;
+
+        // Coefficients of Acklam's rational approximations
+        static const double a[] = {-3.969683028665376e+01,  2.209460984245205e+02,
+                                   -2.759285104469687e+02,  1.383577518672690e+02,
+                                   -3.066479806614716e+01,  2.506628277459239e+00};
+        static const double b[] = {-5.447609879822406e+01,  1.615858368580409e+02,
+                                   -1.556989798598866e+02,  6.680131188771972e+01,
+                                   -1.328068155288572e+01};
+        static const double c[] = {-7.784894002430293e-03, -3.223964580411365e-01,
+                                   -2.400758277161838e+00, -2.549732539343734e+00,
+                                    4.374664141464968e+00,  2.938163982698783e+00};
+        static const double d[] = { 7.784695709041462e-03,  3.224671290700398e-01,
+                                    2.445134137142996e+00,  3.754408661907416e+00};
+
+        const double p_low = 0.02425;
+        double x;
+
+        if (p < p_low) {
+            // Lower tail
+            double q = std::sqrt(-2.0 * std::log(p));
+            x = (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+                ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+        } else if (p <= 1.0 - p_low) {
+            // Central region
+            double q = p - 0.5;
+            double r = q * q;
+            x = (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+                (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1.0);
+        } else {
+            // Upper tail
+            double q = std::sqrt(-2.0 * std::log(1.0 - p));
+            x = -(((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+                 ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+        }
+
+        // One step of Halley's method on Phi(x) - p (erfc keeps the tails accurate)
+        double e = 0.5 * std::erfc(-x / std::sqrt(2.0)) - p;
+        double u = e * std::sqrt(2.0 * M_PI) * std::exp(0.5 * x * x);
+        return x - u / (1.0 + 0.5 * x * u);
+    }
+
 
     // --- Helper Functions (d1 and d2) Implementation ---
     
@@ -43,6 +87,24 @@ namespace BlackScholesFormulas {
         d2 = d1 - sigma_sqrt_T;
     }
 
+    // --- Analytic Prices for European Options ---
+
+    double callPrice(double S, double K, double T, double r, double sigma) {
+        double d1, d2;
+        calculate_d1_d2(S, K, T, r, sigma, d1, d2);
+
+        // Call = S * Phi(d1) - K * exp(-rT) * Phi(d2)
+        return S * N_cdf(d1) - K * std::exp(-r * T) * N_cdf(d2);
+    }
+
+    double putPrice(double S, double K, double T, double r, double sigma) {
+        double d1, d2;
+        calculate_d1_d2(S, K, T, r, sigma, d1, d2);
+
+        // Put = K * exp(-rT) * Phi(-d2) - S * Phi(-d1)
+        return K * std::exp(-r * T) * N_cdf(-d2) - S * N_cdf(-d1);
+    }
+
     // --- Analytic Greeks for European Options ---
 
     double deltaCall(double S, double K, double T, double r, double sigma) {
@@ -0,0 +1,46 @@
+#include "Utils/FFT.hpp"
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace FFT {
+
+    void forward(std::vector<std::complex<double>>& data) {
+        const std::size_t n = data.size();
+        if (n == 0 || (n & (n - 1)) != 0) {
+            throw std::invalid_argument("Error: the FFT size must be a power of two.");
+        }
+
+        // 1. Bit-reversal permutation
+        for (std::size_t i = 1, j = 0; i < n; ++i) {
+            std::size_t bit = n >> 1;
+            for (; j & bit; bit >>= 1) {
+                j ^= bit;
+            }
+            j ^= bit;
+            if (i < j) {
+                std::swap(data[i], data[j]);
+            }
+        }
+
+        // 2. Butterfly passes of increasing length
+        for (std::size_t len = 2; len <= n; len <<= 1) {
+            const double angle = -2.0 * M_PI / static_cast<double>(len);
+            const std::complex<double> w_len(std::cos(angle), std::sin(angle));
+            for (std::size_t start = 0; start < n; start += len) {
+                std::complex<double> w(1.0, 0.0);
+                for (std::size_t k = 0; k < len / 2; ++k) {
+                    std::complex<double> even = data[start + k];
+                    std::complex<double> odd = data[start + k + len / 2] * w;
+                    data[start + k] = even + odd;
+                    data[start + k + len / 2] = even - odd;
+                    w *= w_len;
+                }
+            }
+        }
+    }
+}
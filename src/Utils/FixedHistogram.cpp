@@ -0,0 +1,118 @@
+#include "Utils/FixedHistogram.hpp"
+#include "Utils/BinaryIO.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+FixedHistogram::FixedHistogram(double lower_in, double upper_in, int bins)
+    : lower(lower_in), upper(upper_in)
+{
+    if (!(upper > lower) || bins <= 0) {
+        throw std::invalid_argument("Error: FixedHistogram requires upper > lower and at least one bin.");
+    }
+    counts.assign(static_cast<std::size_t>(bins), 0);
+    inverse_width = bins / (upper - lower);
+}
+
+void FixedHistogram::add(double x) {
+    if (counts.empty()) return;
+    if (std::isnan(x)) {
+        // Would fail both range tests, and casting NaN to an index is undefined
+        ++nan_count;
+        return;
+    }
+    ++total;
+    if (x < lower) {
+        ++underflow;
+    } else if (x >= upper) {
+        ++overflow;
+    } else {
+        // Rounding may put a value just below upper in the bin past the end
+        std::size_t bin = std::min(static_cast<std::size_t>((x - lower) * inverse_width), counts.size() - 1);
+        ++counts[bin];
+    }
+}
+
+void FixedHistogram::add(const double* values, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        add(values[i]);
+    }
+}
+
+void FixedHistogram::merge(const FixedHistogram& other) {
+    if (!other.isEnabled()) return;
+    if (!isEnabled()) {
+        *this = other;
+        return;
+    }
+    if (lower != other.lower || upper != other.upper || counts.size() != other.counts.size()) {
+        throw std::invalid_argument("Error: cannot merge histograms with different layouts.");
+    }
+    for (std::size_t i = 0; i < counts.size(); ++i) {
+        counts[i] += other.counts[i];
+    }
+    underflow += other.underflow;
+    overflow += other.overflow;
+    nan_count += other.nan_count;
+    total += other.total;
+}
+
+double FixedHistogram::getQuantile(double q) const {
+
+    if (total == 0) return 0.0;
+    double target = std::min(1.0, std::max(0.0, q)) * static_cast<double>(total);
+
+    double cumulative = static_cast<double>(underflow);
+    if (target <= cumulative) return lower;
+
+    const double width = getBinWidth();
+    for (std::size_t i = 0; i < counts.size(); ++i) {
+        double next = cumulative + static_cast<double>(counts[i]);
+        if (target <= next && counts[i] > 0) {
+            return lower + width * (i + (target - cumulative) / static_cast<double>(counts[i]));
+        }
+        cumulative = next;
+    }
+    return upper;
+}
+
+void FixedHistogram::writeBinary(std::ostream& os) const {
+    BinaryIO::writeDouble(os, lower);
+    BinaryIO::writeDouble(os, upper);
+    BinaryIO::writeU64(os, counts.size());
+    for (std::uint64_t c : counts) {
+        BinaryIO::writeU64(os, c);
+    }
+    BinaryIO::writeU64(os, underflow);
+    BinaryIO::writeU64(os, overflow);
+    BinaryIO::writeU64(os, nan_count);
+}
+
+FixedHistogram FixedHistogram::readBinary(std::istream& is, bool with_nan_count) {
+
+    double lower = BinaryIO::readDouble(is);
+    double upper = BinaryIO::readDouble(is);
+    std::uint64_t bins = BinaryIO::readU64(is);
+    if (bins > (1u << 24)) {
+        throw std::runtime_error("Error: corrupted FixedHistogram.");
+    }
+
+    FixedHistogram histogram;
+    if (bins > 0) {
+        if (!(upper > lower)) {
+            throw std::runtime_error("Error: corrupted FixedHistogram.");
+        }
+        histogram = FixedHistogram(lower, upper, static_cast<int>(bins));
+    }
+    for (std::uint64_t i = 0; i < bins; ++i) {
+        histogram.counts[i] = BinaryIO::readU64(is);
+        histogram.total += histogram.counts[i];
+    }
+    histogram.underflow = BinaryIO::readU64(is);
+    histogram.overflow = BinaryIO::readU64(is);
+    histogram.total += histogram.underflow + histogram.overflow;
+    if (with_nan_count) {
+        histogram.nan_count = BinaryIO::readU64(is);
+    }
+    return histogram;
+}
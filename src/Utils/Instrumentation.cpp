@@ -0,0 +1,173 @@
+#include "Utils/Instrumentation.hpp"
+#include <sstream>
+
+#ifdef PRICER_INSTRUMENTATION
+    #include <chrono>
+    #include <memory>
+    #include <mutex>
+    #include <vector>
+#endif
+
+const char* Instrumentation::phaseName(Phase phase) {
+    switch (phase) {
+        case RandomNumbers:    return "random_numbers";
+        case PathConstruction: return "path_construction";
+        case Payoff:           return "payoff";
+        case Statistics:       return "statistics";
+        default:               return "unknown";
+    }
+}
+
+const char* Instrumentation::counterName(Counter counter) {
+    switch (counter) {
+        case Paths:       return "paths";
+        case Draws:       return "draws";
+        case Allocations: return "allocations";
+        default:          return "unknown";
+    }
+}
+
+Instrumentation::Snapshot& Instrumentation::Snapshot::operator+=(const Snapshot& other) {
+    for (int i = 0; i < PHASE_COUNT; ++i) seconds[i] += other.seconds[i];
+    for (int i = 0; i < COUNTER_COUNT; ++i) counts[i] += other.counts[i];
+    return *this;
+}
+
+Instrumentation::Snapshot Instrumentation::Snapshot::operator-(const Snapshot& other) const {
+    Snapshot difference = *this;
+    for (int i = 0; i < PHASE_COUNT; ++i) difference.seconds[i] -= other.seconds[i];
+    for (int i = 0; i < COUNTER_COUNT; ++i) difference.counts[i] -= other.counts[i];
+    return difference;
+}
+
+double Instrumentation::Snapshot::totalSeconds() const {
+    double total = 0.0;
+    for (double s : seconds) total += s;
+    return total;
+}
+
+std::string Instrumentation::toPrometheus(const Snapshot& snapshot, const std::string& prefix) {
+    std::ostringstream out;
+    out << "# TYPE " << prefix << "_phase_seconds_total counter\n";
+    for (int i = 0; i < PHASE_COUNT; ++i) {
+        out << prefix << "_phase_seconds_total{phase=\"" << phaseName(static_cast<Phase>(i)) << "\"} "
+            << snapshot.seconds[i] << "\n";
+    }
+    for (int i = 0; i < COUNTER_COUNT; ++i) {
+        const char* name = counterName(static_cast<Counter>(i));
+        out << "# TYPE " << prefix << "_" << name << "_total counter\n"
+            << prefix << "_" << name << "_total " << snapshot.counts[i] << "\n";
+    }
+    return out.str();
+}
+
+std::string Instrumentation::toJSON(const Snapshot& snapshot) {
+    std::ostringstream out;
+    out << "{\"seconds\": {";
+    for (int i = 0; i < PHASE_COUNT; ++i) {
+        out << (i ? ", " : "") << "\"" << phaseName(static_cast<Phase>(i)) << "\": " << snapshot.seconds[i];
+    }
+    out << "}, \"counts\": {";
+    for (int i = 0; i < COUNTER_COUNT; ++i) {
+        out << (i ? ", " : "") << "\"" << counterName(static_cast<Counter>(i)) << "\": " << snapshot.counts[i];
+    }
+    out << "}}";
+    return out.str();
+}
+
+#ifdef PRICER_INSTRUMENTATION
+
+namespace {
+
+    // Registry of the live thread records, and totals of the threads that have exited
+    struct Registry {
+        std::mutex mutex;
+        std::vector<Instrumentation::ThreadRecord*> records;
+        Instrumentation::Snapshot retired;
+    };
+
+    Registry& registry() {
+        static Registry* instance = new Registry();   // never destroyed: threads may exit after main
+        return *instance;
+    }
+
+    // Ticks per second of readTicks(), measured once against the steady clock
+    double ticksPerSecond() {
+    #if defined(__x86_64__) || defined(__i386__)
+        static const double rate = []() {
+            using Clock = std::chrono::steady_clock;
+            Clock::time_point t0 = Clock::now();
+            std::uint64_t c0 = Instrumentation::readTicks();
+            while (Clock::now() - t0 < std::chrono::milliseconds(20)) {}
+            std::uint64_t c1 = Instrumentation::readTicks();
+            double elapsed = std::chrono::duration<double>(Clock::now() - t0).count();
+            return static_cast<double>(c1 - c0) / elapsed;
+        }();
+        return rate;
+    #else
+        return 1e9;
+    #endif
+    }
+
+    Instrumentation::Snapshot read(const Instrumentation::ThreadRecord& record) {
+        Instrumentation::Snapshot snapshot;
+        const double rate = ticksPerSecond();
+        for (int i = 0; i < Instrumentation::PHASE_COUNT; ++i) {
+            snapshot.seconds[i] = record.ticks[i].load(std::memory_order_relaxed) / rate;
+        }
+        for (int i = 0; i < Instrumentation::COUNTER_COUNT; ++i) {
+            snapshot.counts[i] = record.counts[i].load(std::memory_order_relaxed);
+        }
+        return snapshot;
+    }
+
+    // Owns the record of a thread; on exit its totals are moved to the retired sum
+    struct RecordOwner {
+        std::unique_ptr<Instrumentation::ThreadRecord> record = std::make_unique<Instrumentation::ThreadRecord>();
+        ~RecordOwner() {
+            Registry& reg = registry();
+            std::lock_guard<std::mutex> lock(reg.mutex);
+            reg.retired += read(*record);
+            for (std::size_t i = 0; i < reg.records.size(); ++i) {
+                if (reg.records[i] == record.get()) {
+                    reg.records.erase(reg.records.begin() + static_cast<std::ptrdiff_t>(i));
+                    break;
+                }
+            }
+        }
+    };
+}
+
+Instrumentation::ThreadRecord& Instrumentation::registerThread() {
+    static thread_local RecordOwner owner;
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.records.push_back(owner.record.get());
+    return *owner.record;
+}
+
+Instrumentation::Snapshot Instrumentation::threadSnapshot() {
+    return read(threadRecord());
+}
+
+Instrumentation::Snapshot Instrumentation::globalSnapshot() {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    Snapshot total = reg.retired;
+    for (const ThreadRecord* record : reg.records) {
+        total += read(*record);
+    }
+    return total;
+}
+
+#else
+
+Instrumentation::Snapshot Instrumentation::threadSnapshot() {
+    return Snapshot();
+}
+
+Instrumentation::Snapshot Instrumentation::globalSnapshot() {
+    return Snapshot();
+}
+
+#endif
@@ -0,0 +1,100 @@
+#include "Utils/LatencyHistogram.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+LatencyHistogram::LatencyHistogram()
+    : total_count(0), total_sum(0), max_value(0)
+{
+    for (std::atomic<std::uint64_t>& count : counts) {
+        count.store(0, std::memory_order_relaxed);
+    }
+}
+
+int LatencyHistogram::bucketIndex(std::uint64_t value) {
+
+    // Values below 16 ns have one bucket each
+    if (value < static_cast<std::uint64_t>(SUB_BUCKETS)) {
+        return static_cast<int>(value);
+    }
+
+    // Power of two k >= 4, then the 4 bits that follow the leading one
+    int k = 63;
+    while (!(value >> k)) --k;
+    int sub = static_cast<int>((value >> (k - 4)) & (SUB_BUCKETS - 1));
+    return std::min((k - 3) * SUB_BUCKETS + sub, NUM_BUCKETS - 1);
+}
+
+std::uint64_t LatencyHistogram::bucketUpperEdge(int index) {
+    if (index < SUB_BUCKETS) {
+        return static_cast<std::uint64_t>(index);
+    }
+    int k = index / SUB_BUCKETS + 3;
+    std::uint64_t sub = static_cast<std::uint64_t>(index % SUB_BUCKETS);
+    return ((static_cast<std::uint64_t>(SUB_BUCKETS) + sub + 1) << (k - 4)) - 1;
+}
+
+void LatencyHistogram::record(std::uint64_t nanoseconds) {
+    counts[bucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+    total_count.fetch_add(1, std::memory_order_relaxed);
+    total_sum.fetch_add(nanoseconds, std::memory_order_relaxed);
+
+    std::uint64_t current = max_value.load(std::memory_order_relaxed);
+    while (nanoseconds > current
+           && !max_value.compare_exchange_weak(current, nanoseconds, std::memory_order_relaxed)) {}
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (int i = 0; i < NUM_BUCKETS; ++i) {
+        counts[i].fetch_add(other.counts[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    total_count.fetch_add(other.getCount(), std::memory_order_relaxed);
+    total_sum.fetch_add(other.total_sum.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+    std::uint64_t other_max = other.getMax();
+    std::uint64_t current = max_value.load(std::memory_order_relaxed);
+    while (other_max > current
+           && !max_value.compare_exchange_weak(current, other_max, std::memory_order_relaxed)) {}
+}
+
+std::uint64_t LatencyHistogram::getCount() const {
+    return total_count.load(std::memory_order_relaxed);
+}
+
+double LatencyHistogram::getMean() const {
+    std::uint64_t n = getCount();
+    return (n == 0) ? 0.0 : static_cast<double>(total_sum.load(std::memory_order_relaxed)) / n;
+}
+
+std::uint64_t LatencyHistogram::getQuantile(double q) const {
+
+    std::uint64_t n = getCount();
+    if (n == 0) return 0;
+
+    // Rank of the quantile, then the first bucket whose cumulative count reaches it
+    std::uint64_t rank = static_cast<std::uint64_t>(std::ceil(std::min(std::max(q, 0.0), 1.0) * n));
+    rank = std::max<std::uint64_t>(rank, 1);
+
+    std::uint64_t cumulative = 0;
+    for (int i = 0; i < NUM_BUCKETS; ++i) {
+        cumulative += counts[i].load(std::memory_order_relaxed);
+        if (cumulative >= rank) {
+            return std::min(bucketUpperEdge(i), getMax());
+        }
+    }
+    return getMax();
+}
+
+std::string LatencyHistogram::summary() const {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(1)
+        << "count=" << getCount()
+        << " mean=" << getMean() / 1e3 << "us"
+        << " p50=" << getQuantile(0.50) / 1e3 << "us"
+        << " p90=" << getQuantile(0.90) / 1e3 << "us"
+        << " p99=" << getQuantile(0.99) / 1e3 << "us"
+        << " p99.9=" << getQuantile(0.999) / 1e3 << "us"
+        << " max=" << getMax() / 1e3 << "us";
+    return out.str();
+}
@@ -0,0 +1,79 @@
+#include "Utils/MertonFormulas.hpp"
+#include "Utils/BlackScholesFormulas.hpp"
+#include "Models/Merton.hpp"
+#include "Options/EuropeanCall.hpp"
+#include "Options/EuropeanPut.hpp"
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+    // Series truncation: terms beyond this weight are below double precision
+    const double SERIES_TOLERANCE = 1e-16;
+    const int MAX_SERIES_TERMS = 500;
+
+    double seriesPrice(bool is_call, double S, double K, double T, double r, double sigma,
+                       double lambda, double jump_mean, double jump_vol)
+    {
+        const double k = std::exp(jump_mean + 0.5 * jump_vol * jump_vol) - 1.0;
+        const double lambda_T = lambda * (1.0 + k) * T;
+
+        // 1. Poisson weight of n = 0, updated recursively: w_n = w_{n-1} * lambda'T / n
+        double weight = std::exp(-lambda_T);
+        double total_weight = 0.0;
+        double price = 0.0;
+
+        for (int n = 0; n < MAX_SERIES_TERMS; ++n) {
+            if (n > 0) {
+                weight *= lambda_T / n;
+            }
+
+            // 2. Black-Scholes price conditional on n jumps (the lambda' weights absorb
+            //    the change of discounting from r_n to r)
+            double sigma_n = std::sqrt(sigma * sigma + n * jump_vol * jump_vol / T);
+            double r_n = r - lambda * k + n * (jump_mean + 0.5 * jump_vol * jump_vol) / T;
+            double bs = is_call ? BlackScholesFormulas::callPrice(S, K, T, r_n, sigma_n)
+                                : BlackScholesFormulas::putPrice(S, K, T, r_n, sigma_n);
+
+            price += weight * bs;
+            total_weight += weight;
+
+            // 3. Stop once past the mode and the remaining mass is negligible
+            if (n > lambda_T && 1.0 - total_weight < SERIES_TOLERANCE) {
+                break;
+            }
+        }
+        return price;
+    }
+}
+
+namespace MertonFormulas {
+
+    double callPrice(double S, double K, double T, double r, double sigma,
+                     double lambda, double jump_mean, double jump_vol)
+    {
+        return seriesPrice(true, S, K, T, r, sigma, lambda, jump_mean, jump_vol);
+    }
+
+    double putPrice(double S, double K, double T, double r, double sigma,
+                    double lambda, double jump_mean, double jump_vol)
+    {
+        return seriesPrice(false, S, K, T, r, sigma, lambda, jump_mean, jump_vol);
+    }
+
+    double price(const Option& option, const Merton& model) {
+        const double S = model.getS0();
+        const double T = option.getT();
+        const double r = option.getR();
+
+        if (const EuropeanCall* call = dynamic_cast<const EuropeanCall*>(&option)) {
+            return callPrice(S, call->getK(), T, r, model.getSigma(),
+                             model.getLambda(), model.getJumpMean(), model.getJumpVol());
+        }
+        if (const EuropeanPut* put = dynamic_cast<const EuropeanPut*>(&option)) {
+            return putPrice(S, put->getK(), T, r, model.getSigma(),
+                            model.getLambda(), model.getJumpMean(), model.getJumpVol());
+        }
+        throw std::invalid_argument("Error: Merton closed form is only available for European calls and puts.");
+    }
+}
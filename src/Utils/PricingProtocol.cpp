@@ -0,0 +1,154 @@
+#include "Utils/PricingProtocol.hpp"
+#include "Utils/BinaryIO.hpp"
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+    void writeString(std::ostream& os, const std::string& s) {
+        BinaryIO::writeU32(os, static_cast<std::uint32_t>(s.size()));
+        os.write(s.data(), static_cast<std::streamsize>(s.size()));
+    }
+
+    std::string readString(std::istream& is) {
+        std::uint32_t size = BinaryIO::readU32(is);
+        if (size > PricingProtocol::MAX_FRAME_SIZE) {
+            throw std::runtime_error("Error: invalid string length in a pricing message.");
+        }
+        std::string s(size, '\0');
+        if (size > 0 && !is.read(&s[0], size)) {
+            throw std::runtime_error("Error: truncated binary stream.");
+        }
+        return s;
+    }
+
+    void writeTrade(std::ostream& os, const TradeSpec& trade) {
+        writeString(os, trade.id);
+        writeString(os, trade.option_type);
+        BinaryIO::writeU32(os, static_cast<std::uint32_t>(trade.strikes.size()));
+        for (double K : trade.strikes) BinaryIO::writeDouble(os, K);
+        BinaryIO::writeDouble(os, trade.T);
+        BinaryIO::writeDouble(os, trade.r);
+        writeString(os, trade.model);
+        BinaryIO::writeDouble(os, trade.S0);
+        BinaryIO::writeDouble(os, trade.sigma);
+        BinaryIO::writeU32(os, static_cast<std::uint32_t>(trade.steps));
+        writeString(os, trade.engine);
+        BinaryIO::writeDouble(os, trade.target_error);
+        BinaryIO::writeU32(os, static_cast<std::uint32_t>(trade.max_paths));
+        BinaryIO::writeU64(os, trade.seed);
+        BinaryIO::writeU32(os, static_cast<std::uint32_t>(trade.parameters.size()));
+        for (const auto& parameter : trade.parameters) {
+            writeString(os, parameter.first);
+            BinaryIO::writeDouble(os, parameter.second);
+        }
+    }
+
+    // int fields travel as their 32-bit two's complement: a negative value is decoded as
+    // such (and rejected by TradeSpec::validate), never by an out-of-range conversion
+    int readInt(std::istream& is) {
+        std::uint32_t bits = BinaryIO::readU32(is);
+        if (bits <= static_cast<std::uint32_t>(std::numeric_limits<int>::max())) {
+            return static_cast<int>(bits);
+        }
+        return -static_cast<int>(~bits) - 1;
+    }
+
+    TradeSpec readTrade(std::istream& is) {
+        TradeSpec trade;
+        trade.id = readString(is);
+        trade.option_type = readString(is);
+        std::uint32_t num_strikes = BinaryIO::readU32(is);
+        if (num_strikes > 16) {
+            throw std::runtime_error("Error: too many strikes in a pricing request.");
+        }
+        for (std::uint32_t i = 0; i < num_strikes; ++i) trade.strikes.push_back(BinaryIO::readDouble(is));
+        trade.T = BinaryIO::readDouble(is);
+        trade.r = BinaryIO::readDouble(is);
+        trade.model = readString(is);
+        trade.S0 = BinaryIO::readDouble(is);
+        trade.sigma = BinaryIO::readDouble(is);
+        trade.steps = readInt(is);
+        trade.engine = readString(is);
+        trade.target_error = BinaryIO::readDouble(is);
+        trade.max_paths = readInt(is);
+        trade.seed = BinaryIO::readU64(is);
+        std::uint32_t num_parameters = BinaryIO::readU32(is);
+        for (std::uint32_t i = 0; i < num_parameters; ++i) {
+            std::string name = readString(is);
+            trade.parameters[name] = BinaryIO::readDouble(is);
+        }
+        return trade;
+    }
+
+    void writeResult(std::ostream& os, const TradeResult& result) {
+        writeString(os, result.id);
+        BinaryIO::writeDouble(os, result.price);
+        BinaryIO::writeDouble(os, result.standard_error);
+        BinaryIO::writeU64(os, static_cast<std::uint64_t>(result.paths));
+        BinaryIO::writeDouble(os, result.seconds);
+        writeString(os, result.error);
+    }
+
+    TradeResult readResult(std::istream& is) {
+        TradeResult result;
+        result.id = readString(is);
+        result.price = BinaryIO::readDouble(is);
+        result.standard_error = BinaryIO::readDouble(is);
+        result.paths = static_cast<long long>(BinaryIO::readU64(is));
+        result.seconds = BinaryIO::readDouble(is);
+        result.error = readString(is);
+        return result;
+    }
+}
+
+std::string PricingProtocol::encode(const Message& message) {
+
+    std::ostringstream payload(std::ios::binary);
+    BinaryIO::writeU32(payload, static_cast<std::uint32_t>(message.type));
+    BinaryIO::writeU64(payload, message.request_id);
+
+    switch (message.type) {
+        case MessageType::PriceRequest:  writeTrade(payload, message.trade); break;
+        case MessageType::PriceResponse: writeResult(payload, message.result); break;
+        case MessageType::StatsRequest:  break;
+        case MessageType::StatsResponse: writeString(payload, message.text); break;
+    }
+
+    std::ostringstream frame(std::ios::binary);
+    BinaryIO::writeU32(frame, static_cast<std::uint32_t>(payload.str().size()));
+    frame << payload.str();
+    return frame.str();
+}
+
+bool PricingProtocol::decode(const std::string& buffer, std::size_t& offset, Message& message) {
+
+    if (buffer.size() - offset < 4) return false;
+
+    std::istringstream header(buffer.substr(offset, 4), std::ios::binary);
+    std::uint32_t length = BinaryIO::readU32(header);
+    if (length > MAX_FRAME_SIZE) {
+        throw std::runtime_error("Error: pricing message too large.");
+    }
+    if (buffer.size() - offset - 4 < length) return false;
+
+    std::istringstream payload(buffer.substr(offset + 4, length), std::ios::binary);
+    std::uint32_t type = BinaryIO::readU32(payload);
+    if (type < 1 || type > 4) {
+        throw std::runtime_error("Error: unknown pricing message type.");
+    }
+    message = Message();
+    message.type = static_cast<MessageType>(type);
+    message.request_id = BinaryIO::readU64(payload);
+
+    switch (message.type) {
+        case MessageType::PriceRequest:  message.trade = readTrade(payload); break;
+        case MessageType::PriceResponse: message.result = readResult(payload); break;
+        case MessageType::StatsRequest:  break;
+        case MessageType::StatsResponse: message.text = readString(payload); break;
+    }
+
+    offset += 4 + length;
+    return true;
+}
@@ -0,0 +1,305 @@
+#include "Utils/QuantileSketch.hpp"
+#include "Utils/BinaryIO.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+    // "OPQS" tag followed by the format version
+    const std::uint32_t SKETCH_MAGIC = 0x5351504F;
+    const std::uint32_t SKETCH_VERSION = 1;
+
+    // Scale function k2 and its inverse: k = delta / Z * log(q / (1 - q)), Z = 4 log(n / delta) + 24.
+    // The centroid size is proportional to q (1 - q), so the error is relative in both tails.
+    double normalizer(double delta, double n) {
+        return 4.0 * std::log(std::max(1.0, n / delta)) + 24.0;
+    }
+
+    double scale(double q, double delta, double z) {
+        q = std::min(1.0, std::max(0.0, q));
+        return delta / z * std::log(q / (1.0 - q));
+    }
+
+    double inverseScale(double k, double delta, double z) {
+        return 1.0 / (1.0 + std::exp(-k * z / delta));
+    }
+}
+
+QuantileSketch::QuantileSketch(double compression_in)
+    : compression(compression_in)
+{
+    if (!(compression > 0.0)) {
+        throw std::invalid_argument("Error: QuantileSketch requires a positive compression.");
+    }
+}
+
+std::size_t QuantileSketch::bufferCapacity() const {
+    return static_cast<std::size_t>(2.0 * compression) + 1;
+}
+
+void QuantileSketch::add(double x) {
+    // NaN has no rank (and would break the sort of the buffer)
+    if (std::isnan(x)) return;
+    if (count == 0) {
+        min_value = x;
+        max_value = x;
+    } else {
+        min_value = std::min(min_value, x);
+        max_value = std::max(max_value, x);
+    }
+    ++count;
+    if (buffer.empty()) buffer.reserve(bufferCapacity());
+    buffer.push_back(x);
+    if (buffer.size() >= bufferCapacity()) flush();
+}
+
+void QuantileSketch::add(const double* values, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        add(values[i]);
+    }
+}
+
+void QuantileSketch::flush() {
+    if (buffer.empty()) return;
+    std::sort(buffer.begin(), buffer.end());
+    compress(buffer.data(), buffer.size());
+    buffer.clear();
+}
+
+void QuantileSketch::merge(const QuantileSketch& other) {
+
+    if (other.count == 0) return;
+
+    QuantileSketch scratch(other.compression);
+    const QuantileSketch& source = other.flushed(scratch);
+    flush();
+
+    if (count == 0) {
+        min_value = source.min_value;
+        max_value = source.max_value;
+    } else {
+        min_value = std::min(min_value, source.min_value);
+        max_value = std::max(max_value, source.max_value);
+    }
+    count += source.count;
+    compress(source.centroids.data(), source.centroids.size());
+}
+
+template <class Incoming>
+void QuantileSketch::compress(const Incoming* incoming, std::size_t n) {
+
+    if (n == 0) return;
+
+    double total = 0.0;
+    for (const Centroid& c : centroids) total += c.weight;
+    for (std::size_t j = 0; j < n; ++j) total += weightOf(incoming[j]);
+
+    // Greedy sweep over the union of both sorted lists (merged on the fly): a centroid
+    // grows while it spans less than one unit of k. The output buffer is reused.
+    const double z = normalizer(compression, total);
+    merged.clear();
+
+    std::size_t i = 0, j = 0;
+    auto next = [&]() -> Centroid {
+        if (j >= n || (i < centroids.size() && centroids[i].mean <= meanOf(incoming[j]))) {
+            return centroids[i++];
+        }
+        Centroid c{meanOf(incoming[j]), weightOf(incoming[j])};
+        ++j;
+        return c;
+    };
+
+    Centroid current = next();
+    double weight_before = 0.0;
+    double weight_limit = total * inverseScale(scale(0.0, compression, z) + 1.0, compression, z);
+
+    while (i < centroids.size() || j < n) {
+        Centroid c = next();
+        double proposed = current.weight + c.weight;
+        if (weight_before + proposed <= weight_limit) {
+            current.mean += (c.mean - current.mean) * c.weight / proposed;
+            current.weight = proposed;
+        } else {
+            merged.push_back(current);
+            weight_before += current.weight;
+            weight_limit = total * inverseScale(scale(weight_before / total, compression, z) + 1.0, compression, z);
+            current = c;
+        }
+    }
+    merged.push_back(current);
+    centroids.swap(merged);
+    merged.clear();   // keeps the capacity, so copies of the sketch do not carry stale centroids
+}
+
+const QuantileSketch& QuantileSketch::flushed(QuantileSketch& scratch) const {
+    if (buffer.empty()) return *this;
+    scratch = *this;
+    scratch.flush();
+    return scratch;
+}
+
+double QuantileSketch::getQuantile(double q) const {
+
+    if (count == 0) return 0.0;
+    QuantileSketch scratch(compression);
+    const std::vector<Centroid>& c = flushed(scratch).centroids;
+
+    q = std::min(1.0, std::max(0.0, q));
+    if (c.size() == 1) return min_value + q * (max_value - min_value);
+
+    double total = static_cast<double>(count);
+    double target = q * total;
+
+    // Below the center of the first centroid / above the center of the last one: toward min / max
+    if (target <= 0.5 * c.front().weight) {
+        return min_value + (c.front().mean - min_value) * target / (0.5 * c.front().weight);
+    }
+    if (target >= total - 0.5 * c.back().weight) {
+        double remaining = total - target;
+        return max_value - (max_value - c.back().mean) * remaining / (0.5 * c.back().weight);
+    }
+
+    // Linear interpolation between the centers of two consecutive centroids
+    double center = 0.5 * c[0].weight;
+    for (std::size_t i = 0; i + 1 < c.size(); ++i) {
+        double next_center = center + 0.5 * (c[i].weight + c[i + 1].weight);
+        if (target <= next_center) {
+            double t = (target - center) / (next_center - center);
+            return c[i].mean + t * (c[i + 1].mean - c[i].mean);
+        }
+        center = next_center;
+    }
+    return max_value;
+}
+
+double QuantileSketch::getCDF(double x) const {
+
+    if (count == 0) return 0.0;
+    if (x < min_value) return 0.0;
+    if (x >= max_value) return 1.0;
+
+    QuantileSketch scratch(compression);
+    const std::vector<Centroid>& c = flushed(scratch).centroids;
+    double total = static_cast<double>(count);
+
+    if (c.size() == 1 || x < c.front().mean) {
+        double span = (c.size() == 1 ? max_value : c.front().mean) - min_value;
+        double head = (c.size() == 1 ? total : 0.5 * c.front().weight);
+        return span > 0.0 ? head * (x - min_value) / span / total : 0.0;
+    }
+    if (x >= c.back().mean) {
+        double span = max_value - c.back().mean;
+        double tail = 0.5 * c.back().weight;
+        double above = span > 0.0 ? tail * (max_value - x) / span : 0.0;
+        return (total - above) / total;
+    }
+
+    double center = 0.5 * c[0].weight;
+    for (std::size_t i = 0; i + 1 < c.size(); ++i) {
+        double next_center = center + 0.5 * (c[i].weight + c[i + 1].weight);
+        if (x < c[i + 1].mean) {
+            double span = c[i + 1].mean - c[i].mean;
+            double t = span > 0.0 ? (x - c[i].mean) / span : 1.0;
+            return (center + t * (next_center - center)) / total;
+        }
+        center = next_center;
+    }
+    return 1.0;
+}
+
+double QuantileSketch::getLowerTailMean(double q) const {
+
+    if (count == 0) return 0.0;
+    if (q <= 0.0) return min_value;
+    QuantileSketch scratch(compression);
+    const std::vector<Centroid>& c = flushed(scratch).centroids;
+
+    double target = std::min(1.0, q) * static_cast<double>(count);
+    double sum = 0.0;
+    double taken = 0.0;
+    for (const Centroid& centroid : c) {
+        double w = std::min(centroid.weight, target - taken);
+        sum += w * centroid.mean;
+        taken += w;
+        if (taken >= target) break;
+    }
+    return sum / taken;
+}
+
+double QuantileSketch::getUpperTailMean(double q) const {
+
+    if (count == 0) return 0.0;
+    if (q >= 1.0) return max_value;
+    QuantileSketch scratch(compression);
+    const std::vector<Centroid>& c = flushed(scratch).centroids;
+
+    double target = (1.0 - std::max(0.0, q)) * static_cast<double>(count);
+    double sum = 0.0;
+    double taken = 0.0;
+    for (std::size_t i = c.size(); i-- > 0;) {
+        double w = std::min(c[i].weight, target - taken);
+        sum += w * c[i].mean;
+        taken += w;
+        if (taken >= target) break;
+    }
+    return sum / taken;
+}
+
+std::size_t QuantileSketch::getCentroidCount() const {
+    QuantileSketch scratch(compression);
+    return flushed(scratch).centroids.size();
+}
+
+std::size_t QuantileSketch::getMemoryBytes() const {
+    return (centroids.capacity() + merged.capacity()) * sizeof(Centroid) + buffer.capacity() * sizeof(double);
+}
+
+void QuantileSketch::writeBinary(std::ostream& os) const {
+
+    QuantileSketch scratch(compression);
+    const QuantileSketch& source = flushed(scratch);
+
+    BinaryIO::writeU32(os, SKETCH_MAGIC);
+    BinaryIO::writeU32(os, SKETCH_VERSION);
+    BinaryIO::writeDouble(os, source.compression);
+    BinaryIO::writeU64(os, source.count);
+    BinaryIO::writeDouble(os, source.min_value);
+    BinaryIO::writeDouble(os, source.max_value);
+    BinaryIO::writeU64(os, source.centroids.size());
+    for (const Centroid& c : source.centroids) {
+        BinaryIO::writeDouble(os, c.mean);
+        BinaryIO::writeDouble(os, c.weight);
+    }
+}
+
+QuantileSketch QuantileSketch::readBinary(std::istream& is) {
+
+    if (BinaryIO::readU32(is) != SKETCH_MAGIC) {
+        throw std::runtime_error("Error: not a serialized QuantileSketch.");
+    }
+    if (BinaryIO::readU32(is) != SKETCH_VERSION) {
+        throw std::runtime_error("Error: unsupported QuantileSketch format version.");
+    }
+
+    double compression = BinaryIO::readDouble(is);
+    if (!(compression > 0.0)) {
+        throw std::runtime_error("Error: invalid QuantileSketch compression.");
+    }
+    QuantileSketch sketch(compression);
+    sketch.count = BinaryIO::readU64(is);
+    sketch.min_value = BinaryIO::readDouble(is);
+    sketch.max_value = BinaryIO::readDouble(is);
+
+    std::uint64_t size = BinaryIO::readU64(is);
+    if (size > sketch.count) {
+        throw std::runtime_error("Error: corrupted QuantileSketch.");
+    }
+    sketch.centroids.reserve(static_cast<std::size_t>(std::min<std::uint64_t>(size, sketch.bufferCapacity())));
+    for (std::uint64_t i = 0; i < size; ++i) {
+        double mean = BinaryIO::readDouble(is);
+        double weight = BinaryIO::readDouble(is);
+        sketch.centroids.push_back({mean, weight});
+    }
+    return sketch;
+}
@@ -0,0 +1,327 @@
+#include "Utils/TradeFile.hpp"
+#include <algorithm>
+#include <cctype>
+#include <iomanip>
+#include <cstdlib>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+    std::string trim(const std::string& s) {
+        std::size_t begin = 0, end = s.size();
+        while (begin < end && std::isspace(static_cast<unsigned char>(s[begin]))) ++begin;
+        while (end > begin && std::isspace(static_cast<unsigned char>(s[end - 1]))) --end;
+        return s.substr(begin, end - begin);
+    }
+
+    std::string lower(std::string s) {
+        std::transform(s.begin(), s.end(), s.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return s;
+    }
+
+    bool toNumber(const std::string& text, double& value) {
+        if (text.empty()) return false;
+        char* end = nullptr;
+        value = std::strtod(text.c_str(), &end);
+        return end == text.c_str() + text.size();
+    }
+
+    double requireNumber(const std::string& key, const std::string& text) {
+        double value;
+        if (!toNumber(text, value)) {
+            throw std::runtime_error("invalid number for '" + key + "': " + text);
+        }
+        return value;
+    }
+
+    // Integer fields: the double is range-checked first, casting an out-of-range value is undefined
+    int requireInt(const std::string& key, const std::string& text) {
+        double value = requireNumber(key, text);
+        if (!(value >= std::numeric_limits<int>::min() && value <= std::numeric_limits<int>::max())) {
+            throw std::runtime_error("out of range value for '" + key + "': " + text);
+        }
+        return static_cast<int>(value);
+    }
+
+    std::uint64_t requireSeed(const std::string& key, const std::string& text) {
+        double value = requireNumber(key, text);
+        if (!(value >= 0.0 && value < 18446744073709551616.0)) {
+            throw std::runtime_error("out of range value for '" + key + "': " + text);
+        }
+        return static_cast<std::uint64_t>(value);
+    }
+
+    // Strikes are written "100" or "100;110" (JSON arrays are converted to this form)
+    std::vector<double> parseList(const std::string& key, const std::string& text) {
+        std::vector<double> values;
+        std::stringstream ss(text);
+        std::string item;
+        while (std::getline(ss, item, ';')) {
+            values.push_back(requireNumber(key, trim(item)));
+        }
+        return values;
+    }
+
+    std::string escapeJSON(const std::string& s) {
+        std::string out;
+        for (char c : s) {
+            if (c == '"' || c == '\\') out += '\\';
+            out += (c == '\n') ? ' ' : c;
+        }
+        return out;
+    }
+
+    std::string quoteCSV(const std::string& s) {
+        if (s.find_first_of(",\"\n") == std::string::npos) return s;
+        std::string out = "\"";
+        for (char c : s) {
+            if (c == '"') out += '"';
+            out += (c == '\n') ? ' ' : c;
+        }
+        return out + "\"";
+    }
+}
+
+double TradeSpec::parameter(const std::string& name, double default_value) const {
+    auto it = parameters.find(name);
+    return (it == parameters.end()) ? default_value : it->second;
+}
+
+void TradeSpec::validate() const {
+    if (option_type.empty()) {
+        throw std::runtime_error("missing option type");
+    }
+    if (!(T > 0.0) || steps <= 0 || max_paths <= 0) {
+        throw std::runtime_error("T, steps and max_paths must be positive");
+    }
+}
+
+// --- TradeReader ---
+
+TradeReader::TradeReader(std::istream& input_in, Format format_in)
+    : input(input_in), format(format_in)
+{}
+
+bool TradeReader::nextRecord(std::string& line) {
+    while (std::getline(input, line)) {
+        ++line_number;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        std::string content = trim(line);
+        if (content.empty() || content[0] == '#') continue;
+        line = content;
+        return true;
+    }
+    return false;
+}
+
+bool TradeReader::next(TradeSpec& trade) {
+
+    std::string line;
+    if (!nextRecord(line)) return false;
+
+    // 1. Format detection and CSV header on the first record
+    if (format == Format::Auto) {
+        format = (line[0] == '{') ? Format::JSONL : Format::CSV;
+    }
+    if (format == Format::CSV && columns.empty()) {
+        std::stringstream ss(line);
+        std::string name;
+        while (std::getline(ss, name, ',')) {
+            columns.push_back(lower(trim(name)));
+        }
+        if (!nextRecord(line)) return false;
+    }
+
+    // 2. Key/value fields, then the typed trade. A malformed line becomes a trade in
+    // error, so that the following lines are still read
+    std::map<std::string, std::string> fields;
+    trade = TradeSpec();
+    try {
+        if (format == Format::CSV) {
+            parseCSV(line, fields);
+        } else {
+            parseJSON(line, fields);
+        }
+        toTrade(fields, trade);
+    } catch (const std::exception& e) {
+        trade = TradeSpec();
+        auto id = fields.find("id");
+        if (id != fields.end()) trade.id = id->second;
+        trade.error = "Error: trade file line " + std::to_string(line_number) + ": " + e.what();
+    }
+    if (trade.id.empty()) {
+        trade.id = std::to_string(line_number);
+    }
+    return true;
+}
+
+void TradeReader::parseCSV(const std::string& line, std::map<std::string, std::string>& fields) const {
+
+    std::vector<std::string> values(1);
+    bool quoted = false;
+    for (std::size_t i = 0; i < line.size(); ++i) {
+        char c = line[i];
+        if (quoted) {
+            if (c == '"' && i + 1 < line.size() && line[i + 1] == '"') {
+                values.back() += '"';
+                ++i;
+            } else if (c == '"') {
+                quoted = false;
+            } else {
+                values.back() += c;
+            }
+        } else if (c == '"') {
+            quoted = true;
+        } else if (c == ',') {
+            values.emplace_back();
+        } else {
+            values.back() += c;
+        }
+    }
+    if (values.size() > columns.size()) {
+        throw std::runtime_error("more values than columns");
+    }
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        std::string value = trim(values[i]);
+        if (!value.empty()) fields[columns[i]] = value;
+    }
+}
+
+void TradeReader::parseJSON(const std::string& line, std::map<std::string, std::string>& fields) const {
+
+    // Minimal parser for flat objects: string, number, boolean and number-array values
+    std::size_t pos = 0;
+    auto skipSpaces = [&]() {
+        while (pos < line.size() && std::isspace(static_cast<unsigned char>(line[pos]))) ++pos;
+    };
+    auto expect = [&](char c) {
+        skipSpaces();
+        if (pos >= line.size() || line[pos] != c) {
+            throw std::runtime_error(std::string("malformed JSON, expected '") + c + "'");
+        }
+        ++pos;
+    };
+    auto readString = [&]() {
+        expect('"');
+        std::string s;
+        while (pos < line.size() && line[pos] != '"') {
+            if (line[pos] == '\\' && pos + 1 < line.size()) ++pos;
+            s += line[pos++];
+        }
+        expect('"');
+        return s;
+    };
+    auto readScalar = [&]() {
+        skipSpaces();
+        std::size_t begin = pos;
+        while (pos < line.size() && line[pos] != ',' && line[pos] != '}' && line[pos] != ']') ++pos;
+        return trim(line.substr(begin, pos - begin));
+    };
+
+    expect('{');
+    skipSpaces();
+    if (pos < line.size() && line[pos] == '}') return;
+
+    while (true) {
+        std::string key = lower(readString());
+        expect(':');
+        skipSpaces();
+        std::string value;
+        if (pos < line.size() && line[pos] == '"') {
+            value = readString();
+        } else if (pos < line.size() && line[pos] == '[') {
+            ++pos;
+            skipSpaces();
+            while (pos < line.size() && line[pos] != ']') {
+                if (!value.empty()) value += ';';
+                value += readScalar();
+                skipSpaces();
+                if (pos < line.size() && line[pos] == ',') ++pos;
+            }
+            expect(']');
+        } else {
+            value = readScalar();
+            if (value == "true") value = "1";
+            if (value == "false") value = "0";
+        }
+        if (value != "null" && !value.empty()) fields[key] = value;
+
+        skipSpaces();
+        if (pos < line.size() && line[pos] == ',') {
+            ++pos;
+            continue;
+        }
+        expect('}');
+        break;
+    }
+}
+
+void TradeReader::toTrade(const std::map<std::string, std::string>& fields, TradeSpec& trade) const {
+
+    for (const auto& field : fields) {
+        const std::string& key = field.first;
+        const std::string& value = field.second;
+
+        if (key == "id") trade.id = value;
+        else if (key == "type" || key == "option_type") trade.option_type = lower(value);
+        else if (key == "strikes" || key == "strike" || key == "k") trade.strikes = parseList(key, value);
+        else if (key == "t" || key == "maturity") trade.T = requireNumber(key, value);
+        else if (key == "r") trade.r = requireNumber(key, value);
+        else if (key == "model") trade.model = lower(value);
+        else if (key == "s0" || key == "spot") trade.S0 = requireNumber(key, value);
+        else if (key == "sigma" || key == "vol") trade.sigma = requireNumber(key, value);
+        else if (key == "steps") trade.steps = requireInt(key, value);
+        else if (key == "engine") trade.engine = lower(value);
+        else if (key == "target_error") trade.target_error = requireNumber(key, value);
+        else if (key == "max_paths" || key == "paths") trade.max_paths = requireInt(key, value);
+        else if (key == "seed") trade.seed = requireSeed(key, value);
+        else {
+            double number;
+            if (!toNumber(value, number)) {
+                throw std::runtime_error("unknown field '" + key + "'");
+            }
+            trade.parameters[key] = number;
+        }
+    }
+
+    trade.validate();
+}
+
+// --- TradeResultWriter ---
+
+TradeResultWriter::TradeResultWriter(std::ostream& output_in, TradeReader::Format format_in)
+    : output(output_in), format(format_in == TradeReader::Format::JSONL ? format_in : TradeReader::Format::CSV)
+{}
+
+void TradeResultWriter::write(const TradeResult& result) {
+
+    std::ostringstream line;
+    line << std::setprecision(10);
+
+    if (format == TradeReader::Format::JSONL) {
+        line << "{\"id\":\"" << escapeJSON(result.id) << "\"";
+        if (result.error.empty()) {
+            line << ",\"price\":" << result.price << ",\"standard_error\":" << result.standard_error
+                 << ",\"paths\":" << result.paths;
+        } else {
+            line << ",\"error\":\"" << escapeJSON(result.error) << "\"";
+        }
+        line << ",\"seconds\":" << result.seconds << "}\n";
+    } else {
+        if (!header_written) {
+            output << "id,price,standard_error,paths,seconds,error\n";
+            header_written = true;
+        }
+        line << quoteCSV(result.id) << ',';
+        if (result.error.empty()) {
+            line << result.price << ',' << result.standard_error << ',' << result.paths;
+        } else {
+            line << ",,";
+        }
+        line << ',' << result.seconds << ',' << quoteCSV(result.error) << '\n';
+    }
+    output << line.str();
+}
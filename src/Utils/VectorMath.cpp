@@ -0,0 +1,125 @@
+#include "Utils/VectorMath.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace {
+
+    const double LOG2E = 1.4426950408889634;
+    const double LN2_HI = 6.93147180369123816490e-01;   // ln2 rounded to 32 significant bits
+    const double LN2_LO = 1.90821492927058770002e-10;   // ln2 - LN2_HI
+
+    // Adding 1.5 * 2^52 rounds to an integer stored in the low bits of the mantissa
+    const double ROUND_SHIFTER = 6755399441055744.0;
+
+    // Range handled by the branch-free loop: 2^k stays a normal double
+    const double EXP_LOWER = -708.0;
+    const double EXP_UPPER = 709.782712893384;
+
+    // Values processed per chunk (stack buffer, so that in and out may alias)
+    const std::size_t EXP_CHUNK = 64;
+
+    // Below this length the segmented running sum is not worth its second pass
+    const std::size_t MIN_SEGMENT = 16;
+
+    std::uint64_t bitsOf(double x) {
+        std::uint64_t bits;
+        std::memcpy(&bits, &x, sizeof(bits));
+        return bits;
+    }
+
+    double fromBits(std::uint64_t bits) {
+        double x;
+        std::memcpy(&x, &bits, sizeof(x));
+        return x;
+    }
+}
+
+void VectorMath::exp(const double* in, double* out, std::size_t n) {
+
+    const std::uint64_t shifter_bits = bitsOf(ROUND_SHIFTER);
+    double chunk[EXP_CHUNK];
+
+    for (std::size_t start = 0; start < n; start += EXP_CHUNK) {
+        const std::size_t count = (n - start < EXP_CHUNK) ? n - start : EXP_CHUNK;
+        const double* x = in + start;
+
+        // 1. Branch-free kernel (vectorized): e^x = 2^k * e^r
+        for (std::size_t i = 0; i < count; ++i) {
+            double kd = x[i] * LOG2E + ROUND_SHIFTER;
+            const std::uint64_t k_bits = bitsOf(kd);
+            kd -= ROUND_SHIFTER;
+            const double r = (x[i] - kd * LN2_HI) - kd * LN2_LO;
+
+            // Taylor polynomial of e^r up to r^13 (Horner), |r| <= 0.347
+            double p = 1.0 / 6227020800.0;
+            p = p * r + 1.0 / 479001600.0;
+            p = p * r + 1.0 / 39916800.0;
+            p = p * r + 1.0 / 3628800.0;
+            p = p * r + 1.0 / 362880.0;
+            p = p * r + 1.0 / 40320.0;
+            p = p * r + 1.0 / 5040.0;
+            p = p * r + 1.0 / 720.0;
+            p = p * r + 1.0 / 120.0;
+            p = p * r + 1.0 / 24.0;
+            p = p * r + 1.0 / 6.0;
+            p = p * r + 0.5;
+            p = p * r + 1.0;
+            p = p * r + 1.0;
+
+            // 2^(k-1) built from its exponent bits, times 2p: k = 1024 stays representable
+            const double scale = fromBits((k_bits - shifter_bits + 1022) << 52);
+            chunk[i] = (p + p) * scale;
+        }
+
+        // 2. Out-of-range inputs (rare) are recomputed exactly
+        for (std::size_t i = 0; i < count; ++i) {
+            if (!(x[i] >= EXP_LOWER && x[i] <= EXP_UPPER)) {
+                chunk[i] = std::exp(x[i]);
+            }
+        }
+        std::memcpy(out + start, chunk, count * sizeof(double));
+    }
+}
+
+void VectorMath::cumulativeSum(double* values, std::size_t n, double start) {
+
+    const std::size_t segment = n / 4;
+
+    if (segment < MIN_SEGMENT) {
+        double sum = start;
+        for (std::size_t i = 0; i < n; ++i) {
+            sum += values[i];
+            values[i] = sum;
+        }
+        return;
+    }
+
+    // 1. Running sums of the four segments, advanced together (the last one takes the tail)
+    double* s0 = values;
+    double* s1 = values + segment;
+    double* s2 = values + 2 * segment;
+    double* s3 = values + 3 * segment;
+    double a0 = 0.0, a1 = 0.0, a2 = 0.0, a3 = 0.0;
+    for (std::size_t i = 0; i < segment; ++i) {
+        a0 += s0[i]; s0[i] = a0;
+        a1 += s1[i]; s1[i] = a1;
+        a2 += s2[i]; s2[i] = a2;
+        a3 += s3[i]; s3[i] = a3;
+    }
+    for (std::size_t i = 4 * segment; i < n; ++i) {
+        a3 += values[i];
+        values[i] = a3;
+    }
+
+    // 2. Each segment is shifted by start plus the totals of the segments before it
+    const double offsets[4] = {start, start + a0, start + a0 + a1, start + a0 + a1 + a2};
+    for (std::size_t s = 0; s < 4; ++s) {
+        double* first = values + s * segment;
+        const std::size_t length = (s == 3) ? n - 3 * segment : segment;
+        const double offset = offsets[s];
+        for (std::size_t i = 0; i < length; ++i) {
+            first[i] += offset;
+        }
+    }
+}